@@ -0,0 +1,610 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "print.h"
+#include "profile.h"
+#include "raw_hid_commands.h"
+#include "unicode_fast.h"
+#include "user_data.h"
+#include "ac_overlay.h"
+
+#define SLOTS (1 << AC_OVERLAY_SLOT_BITS)
+
+// Typo keys are five bit codes: letters 1-26, the quote 27 and a word boundary 28.
+#define CODE_BITS 5
+#define CODE_MASK 0x1F
+#define CODE_QUOTE 27
+#define CODE_BOUNDARY 28
+#define TYPO_BITS (CODE_BITS * AC_OVERLAY_MAX_TYPO)
+
+_Static_assert(TYPO_BITS <= 60, "a typo and its length must fit in 64 bits");
+
+// Called for every index slot a lookup reads. tests/test_ac_overlay_lookup.c
+// counts them in its copy of this file.
+#ifndef AC_OVERLAY_COUNT_PROBE
+#    define AC_OVERLAY_COUNT_PROBE()
+#endif
+
+// The overlay has two banks, each [byte count u16][generation u16][records].
+// A record is [typo key u64][correction length][flags][correction]. A typo
+// key holds the codes with the last key in the low bits and the number of
+// keys on top, so the last n typed keys form a key with one mask and one or.
+// The bank with the newer generation holds the rules.
+#define REGION_HEADER 4
+#define RECORD_HEADER 10
+#define RECORD_DEAD 0x01
+
+static uint8_t  region[AC_OVERLAY_SIZE]; // copy of the active bank
+static uint8_t  bank;
+static uint16_t generation;
+static uint16_t used; // record bytes after the header
+static uint16_t dead; // bytes in deleted records
+static uint16_t rule_count;
+static uint16_t lengths;      // bit n set if some typo has n keys
+static uint16_t slots[SLOTS]; // record offset + 1, 0 if empty
+
+static uint64_t window; // codes of the last keys, newest lowest
+static uint8_t  window_len;
+static bool     reset_qmk;
+
+static uint8_t  learn_state; // ac_overlay_learn_state_t
+static uint32_t learn_timer; // last key in learn mode, or its end
+static char     learn_typo[AC_OVERLAY_MAX_TYPO + 1];
+static uint8_t  learn_typo_len;
+static char     learn_correction[AC_OVERLAY_MAX_CORRECTION + 1];
+static uint8_t  learn_correction_len;
+
+static uint64_t record_key(const uint8_t *record) {
+    uint64_t key;
+    memcpy(&key, record, sizeof(key));
+    return key;
+}
+
+static uint16_t record_size(const uint8_t *record) {
+    return RECORD_HEADER + record[8];
+}
+
+static uint8_t key_length(uint64_t key) {
+    return key >> TYPO_BITS;
+}
+
+static uint16_t slot_of(uint64_t key) {
+    uint32_t mixed = (uint32_t)key ^ (uint32_t)(key >> 29);
+    return (mixed * 0x9E3779B1u) >> (32 - AC_OVERLAY_SLOT_BITS);
+}
+
+static uint8_t *find(uint64_t key) {
+    uint16_t slot = slot_of(key);
+
+    for (uint8_t probe = 0; probe < AC_OVERLAY_MAX_PROBES; probe++, slot = (slot + 1) & (SLOTS - 1)) {
+        AC_OVERLAY_COUNT_PROBE();
+        if (!slots[slot]) return NULL;
+        uint8_t *record = region + slots[slot] - 1;
+        if (record_key(record) == key) return record;
+    }
+    return NULL;
+}
+
+static bool index_has_room(uint64_t key) {
+    uint16_t slot = slot_of(key);
+
+    for (uint8_t probe = 0; probe < AC_OVERLAY_MAX_PROBES; probe++, slot = (slot + 1) & (SLOTS - 1)) {
+        if (!slots[slot]) return true;
+    }
+    return false;
+}
+
+static void save(uint16_t offset, uint16_t size) {
+    eeconfig_update_user_datablock(region + offset, USER_DATA_AC_OVERLAY_OFFSET + bank * AC_OVERLAY_SIZE + offset, size);
+}
+
+static void mark_dead(uint8_t *record) {
+    record[9] |= RECORD_DEAD;
+    save(record - region + 9, 1);
+    dead += record_size(record);
+}
+
+// A record for a typo that is already indexed replaces the older one, which
+// is marked dead only now. Until then a power loss leaves both stored, and
+// init() keeps the newer.
+static bool index_insert(uint16_t offset) {
+    uint64_t key  = record_key(region + offset);
+    uint16_t slot = slot_of(key);
+
+    for (uint8_t probe = 0; probe < AC_OVERLAY_MAX_PROBES; probe++, slot = (slot + 1) & (SLOTS - 1)) {
+        if (!slots[slot]) {
+            slots[slot] = offset + 1;
+            lengths |= 1 << key_length(key);
+            rule_count++;
+            return true;
+        }
+        uint8_t *older = region + slots[slot] - 1;
+        if (record_key(older) == key) {
+            slots[slot] = offset + 1;
+            mark_dead(older);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Linear probing can't delete in place, so any removal rebuilds the index.
+static void rebuild_index(void) {
+    memset(slots, 0, sizeof(slots));
+    lengths    = 0;
+    rule_count = 0;
+    for (uint16_t offset = REGION_HEADER; offset < REGION_HEADER + used; offset += record_size(region + offset)) {
+        if (!(region[offset + 9] & RECORD_DEAD) && !index_insert(offset)) {
+            dprintf("ac overlay: no slot for a rule, raise AC_OVERLAY_SLOT_BITS\n");
+        }
+    }
+}
+
+static void save_used(void) {
+    memcpy(region, &used, sizeof(used));
+    save(0, sizeof(used));
+}
+
+// Appends write the record before the byte count that covers it, so a torn
+// append costs at most that rule. Compaction writes the live records to the
+// other bank, then its byte count, then its generation. Only the last write
+// switches banks, the old one stays intact until then.
+static void compact(void) {
+    uint16_t out = REGION_HEADER;
+
+    for (uint16_t in = REGION_HEADER; in < REGION_HEADER + used;) {
+        uint16_t size = record_size(region + in);
+        if (!(region[in + 9] & RECORD_DEAD)) {
+            memmove(region + out, region + in, size);
+            out += size;
+        }
+        in += size;
+    }
+    used = out - REGION_HEADER;
+    dead = 0;
+    bank ^= 1;
+    generation++;
+    save(REGION_HEADER, used);
+    save_used();
+    memcpy(region + sizeof(used), &generation, sizeof(generation));
+    save(sizeof(used), sizeof(generation));
+    rebuild_index();
+}
+
+void ac_overlay_init(void) {
+    uint16_t generations[2];
+
+    user_data_region_init(USER_DATA_REGION_AC_OVERLAY, USER_DATA_AC_OVERLAY_VERSION, USER_DATA_AC_OVERLAY_OFFSET, USER_DATA_AC_OVERLAY_SIZE);
+    for (uint8_t i = 0; i < 2; i++) {
+        eeconfig_read_user_datablock(&generations[i], USER_DATA_AC_OVERLAY_OFFSET + i * AC_OVERLAY_SIZE + sizeof(used), sizeof(generations[i]));
+    }
+    bank       = (int16_t)(generations[1] - generations[0]) > 0;
+    generation = generations[bank];
+    eeconfig_read_user_datablock(region, USER_DATA_AC_OVERLAY_OFFSET + bank * AC_OVERLAY_SIZE, sizeof(region));
+    dead = 0;
+    memcpy(&used, region, sizeof(used));
+    if (used > AC_OVERLAY_SIZE - REGION_HEADER) used = 0;
+
+    uint16_t offset = REGION_HEADER;
+    while (offset + RECORD_HEADER <= REGION_HEADER + used) {
+        const uint8_t *record = region + offset;
+        uint8_t        keys   = key_length(record_key(record));
+        if (!keys || keys > AC_OVERLAY_MAX_TYPO || record[8] > AC_OVERLAY_MAX_CORRECTION || offset + record_size(record) > REGION_HEADER + used) break;
+        if (record[9] & RECORD_DEAD) dead += record_size(record);
+        offset += record_size(record);
+    }
+    used = offset - REGION_HEADER;
+    rebuild_index();
+
+    // QMK's typo buffer starts out with a word boundary as well.
+    window     = CODE_BOUNDARY;
+    window_len = 1;
+}
+
+static bool parse_typo(const char *typo, uint64_t *key) {
+    size_t   length  = strlen(typo);
+    uint64_t codes   = 0;
+    uint8_t  letters = 0;
+
+    if (length > AC_OVERLAY_MAX_TYPO) return false;
+    for (size_t i = 0; i < length; i++) {
+        char    c = typo[i];
+        uint8_t code;
+
+        if (c >= 'a' && c <= 'z') {
+            code = c - 'a' + 1;
+        } else if (c == '\'') {
+            code = CODE_QUOTE;
+        } else if (c == ':' && (i == 0 || i == length - 1)) {
+            code = CODE_BOUNDARY;
+        } else {
+            return false;
+        }
+        if (code != CODE_BOUNDARY) letters++;
+        codes = codes << CODE_BITS | code;
+    }
+    *key = codes | (uint64_t)length << TYPO_BITS;
+    return letters > 0;
+}
+
+static void format_typo(uint64_t key, char *typo) {
+    uint8_t keys = key_length(key);
+
+    for (uint8_t i = 0; i < keys; i++) {
+        uint8_t code = (key >> (CODE_BITS * (keys - 1 - i))) & CODE_MASK;
+        typo[i]      = code == CODE_BOUNDARY ? ':' : code == CODE_QUOTE ? '\'' : 'a' + code - 1;
+    }
+    typo[keys] = '\0';
+}
+
+static void remove_record(uint8_t *record) {
+    mark_dead(record);
+    rebuild_index();
+}
+
+ac_overlay_result_t ac_overlay_add(const char *typo, const char *correction) {
+    uint64_t key;
+    size_t   length = strlen(correction);
+
+    if (!parse_typo(typo, &key) || !length || length > AC_OVERLAY_MAX_CORRECTION) return AC_OVERLAY_INVALID;
+
+    uint8_t *old  = find(key);
+    uint16_t size = RECORD_HEADER + length;
+    if (REGION_HEADER + used - dead - (old ? record_size(old) : 0) + size > AC_OVERLAY_SIZE) return AC_OVERLAY_FULL;
+    // A replaced rule keeps its slot. Slots taken depend only on the set of
+    // rules, not their order, so compaction doesn't change the answer.
+    if (!old && !index_has_room(key)) return AC_OVERLAY_FULL;
+    if (REGION_HEADER + used + size > AC_OVERLAY_SIZE) compact();
+
+    uint16_t offset = REGION_HEADER + used;
+    uint8_t *record = region + offset;
+    memcpy(record, &key, sizeof(key));
+    record[8] = length;
+    record[9] = 0;
+    memcpy(record + RECORD_HEADER, correction, length);
+    used += size;
+    save(offset, size);
+    save_used();
+    index_insert(offset);
+    return AC_OVERLAY_OK;
+}
+
+ac_overlay_result_t ac_overlay_delete(const char *typo) {
+    uint64_t key;
+
+    if (!parse_typo(typo, &key)) return AC_OVERLAY_INVALID;
+    uint8_t *record = find(key);
+    if (!record) return AC_OVERLAY_NOT_FOUND;
+    remove_record(record);
+    return AC_OVERLAY_OK;
+}
+
+void ac_overlay_clear(void) {
+    used = 0;
+    dead = 0;
+    save_used();
+    rebuild_index();
+}
+
+static void learn_end(ac_overlay_learn_state_t outcome) {
+    learn_state = outcome;
+    learn_timer = timer_read32();
+}
+
+static void learn_task(void) {
+    switch (learn_state) {
+        case AC_OVERLAY_LEARN_TYPO:
+        case AC_OVERLAY_LEARN_CORRECTION:
+            if (timer_elapsed32(learn_timer) >= AC_OVERLAY_LEARN_TIMEOUT) learn_end(AC_OVERLAY_LEARN_CANCELLED);
+            break;
+        case AC_OVERLAY_LEARN_SAVING: {
+            ac_overlay_result_t result = ac_overlay_add(learn_typo, learn_correction);
+            dprintf("ac overlay: %s -> %s: %u\n", learn_typo, learn_correction, result);
+            learn_end(result == AC_OVERLAY_OK ? AC_OVERLAY_LEARN_LEARNED : AC_OVERLAY_LEARN_FAILED);
+            break;
+        }
+        case AC_OVERLAY_LEARN_OFF:
+            break;
+        default:
+            if (timer_elapsed32(learn_timer) >= AC_OVERLAY_LEARN_SHOW) learn_state = AC_OVERLAY_LEARN_OFF;
+            break;
+    }
+}
+
+void ac_overlay_task(void) {
+    learn_task();
+
+    uint16_t free = AC_OVERLAY_SIZE - REGION_HEADER - used;
+
+    if (!dead || (dead < AC_OVERLAY_SIZE / 4 && free >= AC_OVERLAY_SIZE / 8)) return;
+    if (last_input_activity_elapsed() < AC_OVERLAY_COMPACT_IDLE) return;
+    compact();
+}
+
+void ac_overlay_forget(void) {
+    window     = 0;
+    window_len = 0;
+}
+
+void ac_overlay_autocorrect_user(uint8_t *typo_buffer_size) {
+    if (!reset_qmk) return;
+    reset_qmk         = false;
+    *typo_buffer_size = 0;
+}
+
+void ac_overlay_learn(void) {
+    // The last rule isn't saved yet, its buffers are still in use.
+    if (learn_state == AC_OVERLAY_LEARN_SAVING) return;
+    learn_state          = AC_OVERLAY_LEARN_TYPO;
+    learn_timer          = timer_read32();
+    learn_typo_len       = 0;
+    learn_correction_len = 0;
+}
+
+ac_overlay_learn_state_t ac_overlay_learn_state(void) {
+    return learn_state;
+}
+
+static void learn_append(uint32_t code_point) {
+    uint8_t bytes[4];
+    uint8_t count;
+
+    if (code_point < 0x80) {
+        bytes[0] = code_point;
+        count    = 1;
+    } else if (code_point < 0x800) {
+        bytes[0] = 0xC0 | code_point >> 6;
+        bytes[1] = 0x80 | (code_point & 0x3F);
+        count    = 2;
+    } else if (code_point < 0x10000) {
+        bytes[0] = 0xE0 | code_point >> 12;
+        bytes[1] = 0x80 | ((code_point >> 6) & 0x3F);
+        bytes[2] = 0x80 | (code_point & 0x3F);
+        count    = 3;
+    } else {
+        bytes[0] = 0xF0 | code_point >> 18;
+        bytes[1] = 0x80 | ((code_point >> 12) & 0x3F);
+        bytes[2] = 0x80 | ((code_point >> 6) & 0x3F);
+        bytes[3] = 0x80 | (code_point & 0x3F);
+        count    = 4;
+    }
+    if (learn_correction_len + count > AC_OVERLAY_MAX_CORRECTION) return;
+    memcpy(learn_correction + learn_correction_len, bytes, count);
+    learn_correction_len += count;
+}
+
+// Writing to flash is left to ac_overlay_task(), outside key processing.
+static void learn_finish(void) {
+    if (!learn_correction_len) {
+        learn_end(AC_OVERLAY_LEARN_CANCELLED);
+        return;
+    }
+    memmove(learn_typo + 1, learn_typo, learn_typo_len);
+    learn_typo[0]                          = ':';
+    learn_typo[learn_typo_len + 1]         = ':';
+    learn_typo[learn_typo_len + 2]         = '\0';
+    learn_correction[learn_correction_len] = '\0';
+    learn_state                            = AC_OVERLAY_LEARN_SAVING;
+}
+
+static void learn_key(uint8_t keycode, uint8_t mods) {
+    learn_timer = timer_read32();
+    if (keycode == KC_ESC) {
+        learn_end(AC_OVERLAY_LEARN_CANCELLED);
+        return;
+    }
+    if (learn_state == AC_OVERLAY_LEARN_TYPO) {
+        switch (keycode) {
+            case KC_A ... KC_Z:
+            case KC_QUOT:
+                // Room for the two word boundaries.
+                if (learn_typo_len < AC_OVERLAY_MAX_TYPO - 2) learn_typo[learn_typo_len++] = keycode == KC_QUOT ? '\'' : 'a' + keycode - KC_A;
+                break;
+            case KC_BSPC:
+                if (learn_typo_len) learn_typo_len--;
+                break;
+            case KC_SPC:
+                if (learn_typo_len) learn_state = AC_OVERLAY_LEARN_CORRECTION;
+                break;
+        }
+        return;
+    }
+    switch (keycode) {
+        case KC_ENT:
+            learn_finish();
+            break;
+        case KC_BSPC:
+            // Drops the continuation bytes and the lead byte of the last character.
+            while (learn_correction_len && (learn_correction[--learn_correction_len] & 0xC0) == 0x80) {
+            }
+            break;
+        default: {
+            uint32_t code_point = unicode_fast_key_code_point(keycode, mods);
+            if (code_point) learn_append(code_point);
+            break;
+        }
+    }
+}
+
+// Learn mode takes the keys before QMK's autocorrect handler, which turns
+// shifted digits and punctuation into 16-bit keycodes and drops AltGr.
+static void learn_record(uint16_t keycode, keyrecord_t *record, uint8_t mods) {
+    if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
+        if (!record->tap.count) return;
+        keycode = IS_QK_MOD_TAP(keycode) ? QK_MOD_TAP_GET_TAP_KEYCODE(keycode) : QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+    } else if (IS_QK_MODS(keycode)) {
+        // Bit 4 of the keycode's mods selects the right hand ones.
+        uint8_t keycode_mods = QK_MODS_GET_MODS(keycode);
+        mods |= keycode_mods & 0x10 ? (keycode_mods & 0x0F) << 4 : keycode_mods;
+        keycode = QK_MODS_GET_BASIC_KEYCODE(keycode);
+    }
+    // Shortcuts aren't text. Right Alt is AltGr.
+    if (keycode > QK_BASIC_MAX || (mods & (MOD_MASK_CG | MOD_BIT(KC_LALT)))) return;
+    learn_key(keycode, mods);
+}
+
+static bool apply(const uint8_t *record, uint64_t key) {
+    char    typo[AC_OVERLAY_MAX_TYPO + 1];
+    char    correction[AC_OVERLAY_MAX_CORRECTION + 1];
+    uint8_t keys       = key_length(key);
+    bool    starts     = ((key >> (CODE_BITS * (keys - 1))) & CODE_MASK) == CODE_BOUNDARY;
+    uint8_t backspaces = keys - starts - 1; // the typed letters, except the one just pressed unless a boundary ends the typo
+
+    format_typo(key, typo);
+    memcpy(correction, record + RECORD_HEADER, record[8]);
+    correction[record[8]] = '\0';
+    if (!apply_autocorrect(backspaces, correction, typo, correction)) return false;
+
+    for (uint8_t i = 0; i < backspaces; i++) {
+        tap_code(KC_BSPC);
+    }
+    unicode_fast_send_string(correction);
+    return true;
+}
+
+// The rule for the shortest typo longer than `*keys` keys that ends the
+// window, like the flashed trie finds the shortest first, with its length in
+// `*keys` and its index key in `*key`. At most one index lookup per typo
+// length in use, each reading at most AC_OVERLAY_MAX_PROBES slots.
+static const uint8_t *lookup(uint8_t *keys, uint64_t *key) {
+    for ((*keys)++; *keys <= window_len && lengths >> *keys; (*keys)++) {
+        if (!(lengths & (1 << *keys))) continue;
+
+        *key                = (window & (((uint64_t)1 << (CODE_BITS * *keys)) - 1)) | (uint64_t)*keys << TYPO_BITS;
+        const uint8_t *rule = find(*key);
+        if (rule) return rule;
+    }
+    return NULL;
+}
+
+// Follows QMK's process_autocorrect(), which runs after process_record_user():
+// the same keys extend, trim or clear the typo window.
+bool process_ac_overlay(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed) return true;
+
+    uint8_t mods = get_mods();
+#ifndef NO_ACTION_ONESHOT
+    mods |= get_oneshot_mods();
+#endif
+    // Keys typed to teach a rule are tracked but never corrected.
+    bool learning = learn_state == AC_OVERLAY_LEARN_TYPO || learn_state == AC_OVERLAY_LEARN_CORRECTION;
+    if (learning) learn_record(keycode, record, mods);
+
+    uint8_t size = window_len;
+    if (!process_autocorrect_default_handler(&keycode, record, &size, &mods)) {
+        if (!size) ac_overlay_forget();
+        return true;
+    }
+    if (!autocorrect_is_enabled() || leader_sequence_active()) {
+        ac_overlay_forget();
+        return true;
+    }
+
+    uint8_t code;
+    switch (keycode) {
+        case KC_A ... KC_Z:
+            code = keycode - KC_A + 1;
+            break;
+        case KC_ENT:
+            ac_overlay_forget();
+            // fall through
+        case KC_1 ... KC_0:
+        case KC_TAB ... KC_SCLN:
+        case KC_GRV ... KC_SLSH:
+            code = CODE_BOUNDARY;
+            break;
+        case KC_QUOT:
+            code = mods & MOD_MASK_SHIFT ? CODE_BOUNDARY : CODE_QUOTE;
+            break;
+        case KC_BSPC:
+            window >>= CODE_BITS;
+            if (window_len) window_len--;
+            return true;
+        default:
+            ac_overlay_forget();
+            return true;
+    }
+    window = (window << CODE_BITS | code) & (((uint64_t)1 << TYPO_BITS) - 1);
+    if (window_len < AC_OVERLAY_MAX_TYPO) window_len++;
+    if (learning) return true;
+
+    uint8_t        keys = 0;
+    uint64_t       key;
+    const uint8_t *rule;
+    do {
+        PROFILE_BEGIN(PROFILE_AC_LOOKUP);
+        rule = lookup(&keys, &key);
+        PROFILE_END(PROFILE_AC_LOOKUP);
+    } while (rule && !apply(rule, key));
+    if (!rule) return true;
+
+    reset_qmk = true;
+    if (code == CODE_BOUNDARY) {
+        // The boundary key itself still goes out after the correction.
+        window     = CODE_BOUNDARY;
+        window_len = 1;
+        return true;
+    }
+    ac_overlay_forget();
+    return false;
+}
+
+#ifdef RAW_ENABLE
+static void put_status(uint8_t *data, ac_overlay_result_t result) {
+    data[1] = result;
+    raw_hid_put_u16(data + 2, rule_count);
+    raw_hid_put_u16(data + 4, AC_OVERLAY_SIZE - REGION_HEADER - used + dead);
+}
+
+static uint8_t *live_record(uint16_t index) {
+    for (uint16_t offset = REGION_HEADER; offset < REGION_HEADER + used; offset += record_size(region + offset)) {
+        if (!(region[offset + 9] & RECORD_DEAD) && !index--) return region + offset;
+    }
+    return NULL;
+}
+
+// RAW_HID_AC_OVERLAY_ADD [typo\0][correction\0], _DELETE [typo\0] and _CLEAR
+// answer [cmd][ac_overlay_result_t][rules u16][free bytes u16].
+// RAW_HID_AC_OVERLAY_LIST [index u16] answers [cmd][result][typo\0][correction\0].
+bool ac_overlay_raw_hid_receive(uint8_t *data, uint8_t length) {
+    switch (data[0]) {
+        case RAW_HID_AC_OVERLAY_ADD:
+        case RAW_HID_AC_OVERLAY_DELETE: {
+            data[length - 1] = '\0';
+            const char         *typo = (const char *)data + 1;
+            const char         *rest = typo + strlen(typo) + 1;
+            ac_overlay_result_t result;
+
+            if (data[0] == RAW_HID_AC_OVERLAY_DELETE) {
+                result = ac_overlay_delete(typo);
+            } else {
+                result = rest < (const char *)data + length ? ac_overlay_add(typo, rest) : AC_OVERLAY_INVALID;
+            }
+            put_status(data, result);
+            break;
+        }
+        case RAW_HID_AC_OVERLAY_CLEAR:
+            ac_overlay_clear();
+            put_status(data, AC_OVERLAY_OK);
+            break;
+        case RAW_HID_AC_OVERLAY_LIST: {
+            const uint8_t *record = live_record(data[1] | data[2] << 8);
+
+            memset(data + 1, 0, length - 1);
+            data[1] = AC_OVERLAY_NOT_FOUND;
+            if (record) {
+                char *typo = (char *)data + 2;
+                data[1]    = AC_OVERLAY_OK;
+                format_typo(record_key(record), typo);
+                memcpy(typo + strlen(typo) + 1, record + RECORD_HEADER, record[8]);
+            }
+            break;
+        }
+        default:
+            return false;
+    }
+    raw_hid_send(data, length);
+    return true;
+}
+#endif
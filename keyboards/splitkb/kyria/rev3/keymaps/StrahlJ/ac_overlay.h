@@ -0,0 +1,95 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+#include "user_data_layout.h"
+
+// Autocorrect rules added at runtime, on top of the flashed autocorrect_data.h.
+// Typos use the ac_dict.txt syntax: a-z and ' mean those keycodes, a ':' at
+// either end a word boundary. Corrections are UTF-8 and typed with
+// unicode_fast_send_string(), so umlauts and any other code point work too.
+
+// Keys in a typo, boundaries included, and bytes in a correction.
+#define AC_OVERLAY_MAX_TYPO 12
+#define AC_OVERLAY_MAX_CORRECTION 16
+
+// Index size as a power of two, and how many slots a lookup may probe. A rule
+// that can't be placed within that many is refused, which bounds the work per
+// keystroke to AC_OVERLAY_MAX_PROBES for every typo length in use.
+#ifndef AC_OVERLAY_SLOT_BITS
+#    define AC_OVERLAY_SLOT_BITS 10
+#endif
+#ifndef AC_OVERLAY_MAX_PROBES
+#    define AC_OVERLAY_MAX_PROBES 8
+#endif
+
+// Deleted and replaced rules are squeezed out once keys have been idle this long.
+#ifndef AC_OVERLAY_COMPACT_IDLE
+#    define AC_OVERLAY_COMPACT_IDLE 5000
+#endif
+
+// Learn mode ends by itself once no key was typed for this long, and its
+// outcome stays on the OLED for AC_OVERLAY_LEARN_SHOW ms.
+#ifndef AC_OVERLAY_LEARN_TIMEOUT
+#    define AC_OVERLAY_LEARN_TIMEOUT 10000
+#endif
+#ifndef AC_OVERLAY_LEARN_SHOW
+#    define AC_OVERLAY_LEARN_SHOW 3000
+#endif
+
+typedef enum {
+    AC_OVERLAY_OK,
+    AC_OVERLAY_INVALID,
+    AC_OVERLAY_FULL,
+    AC_OVERLAY_NOT_FOUND,
+} ac_overlay_result_t;
+
+typedef enum {
+    AC_OVERLAY_LEARN_OFF,
+    AC_OVERLAY_LEARN_TYPO,
+    AC_OVERLAY_LEARN_CORRECTION,
+    AC_OVERLAY_LEARN_SAVING, // until the next ac_overlay_task()
+    AC_OVERLAY_LEARN_LEARNED,
+    AC_OVERLAY_LEARN_FAILED, // the overlay is full
+    AC_OVERLAY_LEARN_CANCELLED,
+} ac_overlay_learn_state_t;
+
+// Loads the rules, call from keyboard_post_init_user() after user_data_init().
+void ac_overlay_init(void);
+
+// Tracks the typed keys and applies a matching rule, call from
+// process_record_user(). Returns false if the key was replaced by a correction.
+bool process_ac_overlay(uint16_t keycode, keyrecord_t *record);
+
+// Call from process_autocorrect_user(), so QMK's own typo buffer starts over
+// after the overlay corrected something.
+void ac_overlay_autocorrect_user(uint8_t *typo_buffer_size);
+
+// Call from apply_autocorrect(), the overlay starts over after QMK corrected something.
+void ac_overlay_forget(void);
+
+// Adds or replaces a rule, or deletes one.
+ac_overlay_result_t ac_overlay_add(const char *typo, const char *correction);
+ac_overlay_result_t ac_overlay_delete(const char *typo);
+void                ac_overlay_clear(void);
+
+// Learn mode for a leader sequence: type the typo, space, the correction and
+// enter. Escape or AC_OVERLAY_LEARN_TIMEOUT cancel. The keys reach the host
+// as usual, the rule is added as a whole word typo by the next
+// ac_overlay_task(). The correction takes what the host layout types with
+// one key, shift or AltGr, such as ! ? @ and €; dead keys (^ ` ´) can't be
+// learned, add those rules with tools/ac_overlay.py.
+void ac_overlay_learn(void);
+// Where learn mode is, for the OLED. The outcome is reported for
+// AC_OVERLAY_LEARN_SHOW ms, then AC_OVERLAY_LEARN_OFF again.
+ac_overlay_learn_state_t ac_overlay_learn_state(void);
+
+// Saves a learned rule, ends learn mode on timeout and compacts the stored
+// rules when due, call from housekeeping_task_user().
+void ac_overlay_task(void);
+
+#ifdef RAW_ENABLE
+bool ac_overlay_raw_hid_receive(uint8_t *data, uint8_t length);
+#endif
@@ -0,0 +1,47 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "bitmap_rle.h"
+
+void rle_stream_init(rle_stream_t *stream, const uint8_t *data, uint16_t size, uint16_t offset) {
+    stream->data   = data;
+    stream->size   = size;
+    stream->in     = 0;
+    stream->out    = offset;
+    stream->run    = 0;
+    stream->repeat = false;
+}
+
+bool rle_stream_step(rle_stream_t *stream, uint16_t budget) {
+    while (budget > 0) {
+        if (stream->run == 0) {
+            if (stream->in >= stream->size) {
+                return true;
+            }
+            uint8_t control = pgm_read_byte(stream->data + stream->in++);
+            stream->repeat  = control & 0x80;
+            stream->run     = (control & 0x7F) + 1;
+        }
+
+        // A repeat run reads the same byte every time, a literal run advances.
+        uint8_t value = pgm_read_byte(stream->data + stream->in);
+        if (!stream->repeat || stream->run == 1) {
+            stream->in++;
+        }
+        if (stream->out < OLED_MATRIX_SIZE) {
+            // oled_write_raw_byte() only marks the block dirty if the byte changed.
+            oled_write_raw_byte(value, stream->out);
+        }
+        stream->out++;
+        stream->run--;
+        budget--;
+    }
+    return stream->run == 0 && stream->in >= stream->size;
+}
+
+void oled_write_rle_P(const uint8_t *data, uint16_t size, uint16_t offset) {
+    rle_stream_t stream;
+    rle_stream_init(&stream, data, size, offset);
+    rle_stream_step(&stream, UINT16_MAX);
+}
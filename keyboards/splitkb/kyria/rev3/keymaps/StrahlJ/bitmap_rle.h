@@ -0,0 +1,33 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Bytes decoded per rle_stream_step() call when no budget is given. A full
+// 128x64 screen is spread over four frames so decoding never stalls the scan loop.
+#ifndef BITMAP_RLE_BUDGET
+#    define BITMAP_RLE_BUDGET 256
+#endif
+
+// Decoder state for an RLE stream produced by tools/bitmap_rle.py. The output
+// goes straight into the OLED buffer, so no full-size RAM copy is needed.
+typedef struct {
+    const uint8_t *data;
+    uint16_t       size;
+    uint16_t       in;
+    uint16_t       out;
+    uint8_t        run;
+    bool           repeat;
+} rle_stream_t;
+
+// Starts decoding `size` bytes of compressed PROGMEM data into the OLED buffer at byte `offset`.
+void rle_stream_init(rle_stream_t *stream, const uint8_t *data, uint16_t size, uint16_t offset);
+
+// Decodes at most `budget` output bytes. Returns true once the stream is finished.
+bool rle_stream_step(rle_stream_t *stream, uint16_t budget);
+
+// Decodes a whole stream in one go.
+void oled_write_rle_P(const uint8_t *data, uint16_t size, uint16_t offset);
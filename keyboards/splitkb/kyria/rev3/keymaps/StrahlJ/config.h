@@ -37,6 +37,20 @@
 
 #define OLED_DISPLAY_128X64
 
+// Layer, one-shot mods, caps word and WPM for the slave OLED, see status_sync.c.
+#define SPLIT_TRANSACTION_IDS_USER USER_SYNC_STATUS
+
+// The OLEDs dim and turn off in stages, see idle_governor.h. It replaces QMK's
+// OLED timeout and needs the master's key activity on the slave half.
+#define OLED_TIMEOUT 0
+#define SPLIT_ACTIVITY_ENABLE
+
+// Per-key debounce in ms (DEBOUNCE_TYPE in rules.mk). A press is reported on the
+// scan that sees it and the key is then ignored this long, a release only once
+// it has been stable this long. tests/test_debounce.c types through bouncing
+// contacts with it.
+#define DEBOUNCE 5
+
 #define LED_CAPS_LOCK_PIN 24
 #define LED_PIN_ON_STATE 0
 
@@ -44,16 +58,63 @@
 
 #define ONESHOT_TIMEOUT 5000
 
-#define MOUSEKEY_INTERVAL 16
-#define MOUSEKEY_MAX_SPEED 3
-#define MOUSEKEY_WHEEL_DELTA 0.25
-#define MOUSEKEY_WHEEL_MAX_SPEED 8
+// Mod-tap resolution, see get_tapping_term() and chordal_hold_handedness() in keymap.c.
+#define TAPPING_TERM 200
+#define TAPPING_TERM_PER_KEY
+// The term shrinks linearly to TAPPING_TERM_FAST as the typing speed reaches TAPPING_TERM_FAST_WPM,
+// except for the thumb's Alt/Enter, which keeps TAPPING_TERM.
+#define TAPPING_TERM_FAST 150
+#define TAPPING_TERM_FAST_WPM 100
+// A mod-tap pressed within FLOW_TAP_TERM of the previous letter is a tap right away.
+#define FLOW_TAP_TERM 150
+// With PERMISSIVE_HOLD a mod-tap becomes held when another key is pressed and released while it
+// is still down; pressing that key alone settles nothing before the term runs out. CHORDAL_HOLD
+// limits this to keys from the opposite hand: a key from the same hand settles the mod-tap as
+// tapped when it is pressed, except for Ctrl/Esc. The constants are checked against
+// tests/test_tap_hold.c.
+#define PERMISSIVE_HOLD
+#define CHORDAL_HOLD
+
+// Mouse keys, see mouse_engine.h. Speeds are in pixels or wheel steps per second.
+#define MOUSE_SPEED_MIN 120
+#define MOUSE_SPEED_MAX 1500
+#define MOUSE_ACCEL_TIME 800
+#define MOUSE_CURVE MOUSE_CURVE_QUADRATIC
+#define MOUSE_WHEEL_SPEED 12
 
 #define LEADER_TIMEOUT 400
 #define LEADER_PER_KEY_TIMING
 
-#define DYNAMIC_MACRO_NO_NESTING
+// Persistent state, see user_data_layout.h. The wear leveling region is four
+// times the RP2040 default to leave room for the dynamic macros and both
+// autocorrect overlay banks. QMK's datablock version would default to the
+// size and clear every region when one of them grows; the regions carry
+// their own versions instead, so this one stays put.
+#include "user_data_layout.h"
+#define EECONFIG_USER_DATA_SIZE USER_DATA_SIZE
+#define EECONFIG_USER_DATA_VERSION 1
+#define WEAR_LEVELING_BACKING_SIZE 32768
+#define WEAR_LEVELING_LOGICAL_SIZE 16384
+
+// Dynamic macros are recorded by dyn_macro.c, -1 plays them back with the recorded timing.
+#define DYN_MACRO_PLAY_DELAY 0
 
 #define UNICODE_SELECTED_MODES UNICODE_MODE_LINUX
 
 #define WPM_ALLOW_COUNT_REGRESSION
+
+// Show the matrix scan rate (scans per second) on the status OLED.
+// #define DEBUG_MATRIX_SCAN_RATE
+
+// Show the bytes per second this keymap writes to the OLED on the slave half.
+// #define OLED_BYTES_MONITOR
+
+// Compose the status OLED only in typing pauses and flush one dirty block per loop.
+// #define OLED_DEFER_TO_IDLE
+#ifdef OLED_DEFER_TO_IDLE
+#    define OLED_UPDATE_PROCESS_LIMIT 1
+#endif
+
+// Sleep this many ms per main loop while the OLEDs are off, so the MCU idles
+// between scans. The first key after that is seen up to as much later.
+// #define IDLE_SCAN_SLEEP 1
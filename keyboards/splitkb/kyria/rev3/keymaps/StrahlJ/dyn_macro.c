@@ -0,0 +1,351 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "host.h"
+#include "fast_combo.h"
+#include "user_data.h"
+#include "dyn_macro.h"
+
+// Events are stored delta encoded, usually in two bytes:
+//   key:   matrix position row * MATRIX_COLS + col, or DYN_MACRO_COMBO | combo
+//   flags: DYN_MACRO_PRESSED, DYN_MACRO_TAPPED and the time since the previous
+//          event in DYN_MACRO_TIME_UNIT steps, saturating at DYN_MACRO_DELTA_EXT
+//   [ext]: if saturated, the rest of the delta as a little endian base 128 varint
+// Positions are replayed through process_record(), like QMK's dynamic macros
+// do, so layers, mod-taps and overrides act as they did while recording.
+#define DYN_MACRO_COMBO 0x80
+#define DYN_MACRO_PRESSED 0x80
+#define DYN_MACRO_TAPPED 0x40
+#define DYN_MACRO_DELTA_EXT 0x3F
+#define DYN_MACRO_TIME_UNIT 4
+#define DYN_MACRO_EVENT_MAX 6 // key, flags and a four byte varint
+
+#define DYN_MACRO_NONE 0xFF
+
+_Static_assert(MATRIX_ROWS * MATRIX_COLS <= DYN_MACRO_COMBO, "matrix positions must fit below DYN_MACRO_COMBO");
+_Static_assert(FAST_COMBO_MAX <= DYN_MACRO_COMBO, "combo indices must fit below DYN_MACRO_COMBO");
+
+typedef struct {
+    uint16_t length;
+    uint8_t  events[DYN_MACRO_SIZE];
+} dyn_macro_slot_t;
+
+static dyn_macro_slot_t slots[2];
+static uint8_t          recording = DYN_MACRO_NONE;
+static uint8_t          unsaved; // slots recorded but not yet written, a bit each
+static bool             playing;
+static uint32_t         last_event;
+static int16_t          play_delay = DYN_MACRO_PLAY_DELAY;
+
+// Keys whose press was recorded, only their releases are recorded.
+static uint64_t held_keys;
+static uint64_t held_combos;
+
+// Keys the macro being played holds down.
+static uint64_t played_keys;
+static uint64_t played_combos;
+
+// Playback goes through a host driver that merges consecutive keyboard
+// reports as long as no report presses a key together with another key or
+// a change of modifiers, see batch_send_keyboard().
+static host_driver_t    *real_driver;
+static host_driver_t     batch_driver;
+static report_keyboard_t sent;
+static report_keyboard_t pending;
+static bool              has_pending;
+
+static uint16_t crc_update(uint16_t crc, const uint8_t *data, uint16_t length) {
+    while (length--) {
+        crc ^= *data++ << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+// CRC-16/CCITT of a slot's length and events. A save cut short by a power
+// loss leaves a header that doesn't match what follows it, whichever of the
+// two writes was torn, and the slot loads empty instead of playing a mix of
+// the old and the new recording.
+static uint16_t slot_crc(const dyn_macro_slot_t *slot) {
+    return crc_update(crc_update(0xFFFF, (const uint8_t *)&slot->length, sizeof(slot->length)), slot->events, slot->length);
+}
+
+static uint32_t slot_offset(uint8_t slot) {
+    return USER_DATA_MACRO_OFFSET + slot * (DYN_MACRO_HEADER + DYN_MACRO_SIZE);
+}
+
+void dyn_macro_init(void) {
+    user_data_region_init(USER_DATA_REGION_MACROS, USER_DATA_MACRO_VERSION, USER_DATA_MACRO_OFFSET, USER_DATA_MACRO_SIZE);
+
+    for (uint8_t slot = 0; slot < 2; slot++) {
+        uint16_t header[2];
+
+        eeconfig_read_user_datablock(header, slot_offset(slot), DYN_MACRO_HEADER);
+        slots[slot].length = header[0] <= DYN_MACRO_SIZE ? header[0] : 0;
+        eeconfig_read_user_datablock(slots[slot].events, slot_offset(slot) + DYN_MACRO_HEADER, slots[slot].length);
+        if (slots[slot].length != header[0] || slot_crc(&slots[slot]) != header[1]) slots[slot].length = 0;
+    }
+}
+
+bool dyn_macro_is_recording(void) {
+    return recording != DYN_MACRO_NONE;
+}
+
+void dyn_macro_set_play_delay(int16_t ms) {
+    play_delay = ms;
+}
+
+int16_t dyn_macro_get_play_delay(void) {
+    return play_delay;
+}
+
+static void record_start(uint8_t slot) {
+    // A save still waiting would write the new recording half done.
+    unsaved &= ~(1 << slot);
+    recording          = slot;
+    slots[slot].length = 0;
+    held_keys          = 0;
+    held_combos        = 0;
+    last_event         = timer_read32();
+}
+
+// Recording stops during key processing, the slot is written to flash later
+// by dyn_macro_task().
+static void record_stop(void) {
+    if (recording == DYN_MACRO_NONE) return;
+
+    unsaved |= 1 << recording;
+    recording = DYN_MACRO_NONE;
+}
+
+// The only flash writes, once per recording.
+void dyn_macro_save(void) {
+    for (uint8_t slot = 0; slot < 2; slot++) {
+        if (!(unsaved & (1 << slot))) continue;
+
+        // The header last, its CRC only matches once the events are written.
+        uint16_t header[2] = {slots[slot].length, slot_crc(&slots[slot])};
+        eeconfig_update_user_datablock(slots[slot].events, slot_offset(slot) + DYN_MACRO_HEADER, slots[slot].length);
+        eeconfig_update_user_datablock(header, slot_offset(slot), DYN_MACRO_HEADER);
+    }
+    unsaved = 0;
+}
+
+void dyn_macro_task(void) {
+    if (unsaved && last_input_activity_elapsed() >= DYN_MACRO_SAVE_IDLE) dyn_macro_save();
+}
+
+// Updates the set of held keys or combos `key` belongs to, and returns
+// whether it was held before.
+static bool update_held(uint64_t *keys, uint64_t *combos, keypos_t key, bool pressed) {
+    bool      combo = key.row == FAST_COMBO_ROW;
+    uint64_t  bit   = (uint64_t)1 << (combo ? key.col : key.row * MATRIX_COLS + key.col);
+    uint64_t *held  = combo ? combos : keys;
+    bool      was   = *held & bit;
+
+    if (pressed) {
+        *held |= bit;
+    } else {
+        *held &= ~bit;
+    }
+    return was;
+}
+
+// Returns true if the event should be recorded: every press, and releases of
+// keys whose press was recorded.
+static bool track_key(keypos_t key, bool pressed) {
+    return update_held(&held_keys, &held_combos, key, pressed) || pressed;
+}
+
+static void record_event(keyrecord_t *record) {
+    dyn_macro_slot_t *macro = &slots[recording];
+    keypos_t          key   = record->event.key;
+    uint8_t           event[DYN_MACRO_EVENT_MAX];
+    uint8_t           size  = 0;
+    uint32_t          now   = timer_read32();
+    uint32_t          delta = (now - last_event) / DYN_MACRO_TIME_UNIT;
+    uint8_t           flags = (record->event.pressed ? DYN_MACRO_PRESSED : 0) | (record->tap.count ? DYN_MACRO_TAPPED : 0);
+
+    event[size++] = key.row == FAST_COMBO_ROW ? DYN_MACRO_COMBO | key.col : key.row * MATRIX_COLS + key.col;
+    if (delta < DYN_MACRO_DELTA_EXT) {
+        event[size++] = flags | delta;
+    } else {
+        event[size++] = flags | DYN_MACRO_DELTA_EXT;
+        delta -= DYN_MACRO_DELTA_EXT;
+        do {
+            event[size++] = (delta & 0x7F) | (delta > 0x7F ? 0x80 : 0);
+            delta >>= 7;
+        } while (delta);
+    }
+
+    if (macro->length + size > DYN_MACRO_SIZE) {
+        record_stop(); // full, keep what fits
+        return;
+    }
+    memcpy(macro->events + macro->length, event, size);
+    macro->length += size;
+    // Time is kept in whole units so rounding errors do not add up.
+    last_event = now - (now - last_event) % DYN_MACRO_TIME_UNIT;
+}
+
+static bool has_key(const report_keyboard_t *report, uint8_t key) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == key) return true;
+    }
+    return false;
+}
+
+// Whether `report` can replace the pending one, so that the host gets both
+// changes at once without anything it needs in order. Measured against what
+// the host has, it may press at most one key and then not change the mods,
+// must keep what the pending report pressed and must not press again what
+// that one released.
+static bool can_merge(const report_keyboard_t *report) {
+    uint8_t presses = 0;
+
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t key = report->keys[i];
+        if (key && !has_key(&sent, key)) presses++;
+        key = pending.keys[i];
+        if (key && !has_key(&sent, key) && !has_key(report, key)) return false;
+        key = sent.keys[i];
+        if (key && !has_key(&pending, key) && has_key(report, key)) return false;
+    }
+    return presses == 0 || (presses == 1 && report->mods == sent.mods);
+}
+
+static void batch_flush(void) {
+    if (!has_pending) return;
+    real_driver->send_keyboard(&pending);
+    sent        = pending;
+    has_pending = false;
+    if (DYN_MACRO_REPORT_INTERVAL) wait_ms(DYN_MACRO_REPORT_INTERVAL);
+}
+
+// NKRO reports go straight through, unbatched.
+static void batch_send_keyboard(report_keyboard_t *report) {
+    if (!has_pending || !can_merge(report)) {
+        batch_flush();
+        has_pending = true;
+    }
+    pending = *report;
+}
+
+static void batch_send_mouse(report_mouse_t *report) {
+    batch_flush();
+    real_driver->send_mouse(report);
+}
+
+static void batch_send_extra(report_extra_t *report) {
+    batch_flush();
+    real_driver->send_extra(report);
+}
+
+static void play(uint8_t slot) {
+    const dyn_macro_slot_t *macro       = &slots[slot];
+    layer_state_t           saved_layer = layer_state;
+    uint16_t                i           = 0;
+
+    // Like QMK's dynamic macros, start on the base layer without modifiers,
+    // but keys the user holds stay down.
+    uint8_t saved_mods = get_mods();
+    clear_mods();
+    clear_weak_mods();
+    layer_clear();
+    played_keys   = 0;
+    played_combos = 0;
+    memset(&sent, 0, sizeof(sent));
+    playing                    = true;
+    real_driver                = host_get_driver();
+    batch_driver               = *real_driver;
+    batch_driver.send_keyboard = batch_send_keyboard;
+    batch_driver.send_mouse    = batch_send_mouse;
+    batch_driver.send_extra    = batch_send_extra;
+    host_set_driver(&batch_driver);
+
+    while (i + 1 < macro->length) {
+        uint8_t  key   = macro->events[i++];
+        uint8_t  flags = macro->events[i++];
+        uint32_t delta = flags & DYN_MACRO_DELTA_EXT;
+
+        if (delta == DYN_MACRO_DELTA_EXT) {
+            for (uint8_t shift = 0; i < macro->length; shift += 7) {
+                uint8_t byte = macro->events[i++];
+                delta += (uint32_t)(byte & 0x7F) << shift;
+                if (!(byte & 0x80)) break;
+            }
+        }
+
+        uint32_t wait = play_delay < 0 ? delta * DYN_MACRO_TIME_UNIT : (uint32_t)play_delay;
+        if (wait) {
+            batch_flush();
+            wait_ms(wait);
+        }
+
+        bool        combo  = key & DYN_MACRO_COMBO;
+        keyrecord_t record = {.event = MAKE_KEYEVENT(combo ? FAST_COMBO_ROW : key / MATRIX_COLS, combo ? key & ~DYN_MACRO_COMBO : key % MATRIX_COLS, flags & DYN_MACRO_PRESSED)};
+        record.tap.count   = flags & DYN_MACRO_TAPPED ? 1 : 0;
+        update_held(&played_keys, &played_combos, record.event.key, record.event.pressed);
+        process_record(&record);
+    }
+
+    // A recording stopped with keys down leaves them held, they are let go
+    // here instead of clearing the whole keyboard.
+    for (uint8_t position = 0; played_keys | played_combos; position++) {
+        bool combo = position >= 64;
+        if (!((combo ? played_combos : played_keys) & ((uint64_t)1 << (position & 63)))) continue;
+        keyrecord_t record = {.event = MAKE_KEYEVENT(combo ? FAST_COMBO_ROW : (position & 63) / MATRIX_COLS, combo ? position & 63 : (position & 63) % MATRIX_COLS, false)};
+        update_held(&played_keys, &played_combos, record.event.key, false);
+        process_record(&record);
+    }
+
+    batch_flush();
+    host_set_driver(real_driver);
+    playing = false;
+    layer_state_set(saved_layer);
+    set_mods(saved_mods);
+    send_keyboard_report();
+}
+
+void dyn_macro_command(uint16_t keycode) {
+    switch (keycode) {
+        case QK_DYNAMIC_MACRO_RECORD_START_1:
+        case QK_DYNAMIC_MACRO_RECORD_START_2:
+            if (recording != DYN_MACRO_NONE) {
+                record_stop();
+            } else {
+                record_start(keycode == QK_DYNAMIC_MACRO_RECORD_START_2);
+            }
+            break;
+        case QK_DYNAMIC_MACRO_RECORD_STOP:
+            record_stop();
+            break;
+        case QK_DYNAMIC_MACRO_PLAY_1:
+        case QK_DYNAMIC_MACRO_PLAY_2:
+            // No nesting: a macro can't be played into a recording.
+            if (recording == DYN_MACRO_NONE && !playing) play(keycode == QK_DYNAMIC_MACRO_PLAY_2);
+            break;
+    }
+}
+
+bool process_dyn_macro(uint16_t keycode, keyrecord_t *record) {
+    if (playing) return true;
+
+    switch (keycode) {
+        case QK_DYNAMIC_MACRO_RECORD_START_1 ... QK_DYNAMIC_MACRO_PLAY_2:
+            if (record->event.pressed) dyn_macro_command(keycode);
+            return false;
+    }
+
+    // The leader sequences that start and stop recording are left out.
+    if (recording == DYN_MACRO_NONE || keycode == QK_LEADER) return true;
+    if (record->event.key.row >= MATRIX_ROWS && record->event.key.row != FAST_COMBO_ROW) return true;
+#ifdef LEADER_ENABLE
+    if (leader_sequence_active()) return true;
+#endif
+    if (track_key(record->event.key, record->event.pressed)) record_event(record);
+    return true;
+}
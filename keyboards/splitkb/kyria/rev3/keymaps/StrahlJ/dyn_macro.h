@@ -0,0 +1,46 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+// Milliseconds between played back events. -1 plays them with the recorded
+// timing, 0 as fast as possible, with reports merged where the host can't
+// tell the difference.
+#ifndef DYN_MACRO_PLAY_DELAY
+#    define DYN_MACRO_PLAY_DELAY 0
+#endif
+
+// Delay after every report sent during playback, see SEND_STRING_FAST_INTERVAL.
+#ifndef DYN_MACRO_REPORT_INTERVAL
+#    define DYN_MACRO_REPORT_INTERVAL 1
+#endif
+
+// A finished recording is written to flash once no key has been touched for
+// this many ms, so the write never stalls typing.
+#ifndef DYN_MACRO_SAVE_IDLE
+#    define DYN_MACRO_SAVE_IDLE 1000
+#endif
+
+// Loads both slots from the user datablock, call from keyboard_post_init_user()
+// after user_data_init().
+void dyn_macro_init(void);
+
+// Acts on DM_REC1, DM_REC2, DM_RSTP, DM_PLY1 and DM_PLY2 as if they were tapped.
+void dyn_macro_command(uint16_t keycode);
+
+// Call first in process_record_user(). Records events while a slot is being
+// recorded and handles the DM_* keycodes. Returns false if the event was consumed.
+bool process_dyn_macro(uint16_t keycode, keyrecord_t *record);
+
+bool dyn_macro_is_recording(void);
+
+// Writes finished recordings once the keyboard is idle, call from
+// housekeeping_task_user(). dyn_macro_save() writes them right away, e.g.
+// before suspend.
+void dyn_macro_task(void);
+void dyn_macro_save(void);
+
+void    dyn_macro_set_play_delay(int16_t ms);
+int16_t dyn_macro_get_play_delay(void);
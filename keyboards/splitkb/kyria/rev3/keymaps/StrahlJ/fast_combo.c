@@ -0,0 +1,145 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "action_tapping.h"
+#include "fast_combo.h"
+
+#define FAST_COMBO_NONE 0xFF
+#define POSITION(key) ((key).row * MATRIX_COLS + (key).col)
+#define POSITION_BIT(position) ((uint64_t)1 << (position))
+
+_Static_assert(MATRIX_ROWS * MATRIX_COLS <= 64, "fast_combo.c keeps matrix positions in a 64-bit mask");
+
+static uint8_t  combo_layer;
+static uint64_t combo_masks[FAST_COMBO_MAX];
+static uint32_t position_combos[MATRIX_ROWS * MATRIX_COLS]; // combos each position is part of
+
+// Presses held back while they could still become a combo, in order.
+static keyrecord_t buffer[FAST_COMBO_MAX_KEYS];
+static uint8_t     buffered;
+static uint64_t    buffered_mask;
+static uint32_t    candidates;
+
+// The combo that fired and the keys whose release it still swallows.
+static uint8_t  active = FAST_COMBO_NONE;
+static uint64_t active_mask;
+
+void fast_combo_init(uint8_t layer) {
+    combo_layer = layer;
+    for (uint8_t combo = 0; combo < fast_combos_count && combo < FAST_COMBO_MAX; combo++) {
+        uint64_t mask     = 0;
+        bool     complete = true;
+
+        for (uint8_t i = 0; i < FAST_COMBO_MAX_KEYS && fast_combos[combo].keys[i]; i++) {
+            bool found = false;
+            for (uint8_t position = 0; position < MATRIX_ROWS * MATRIX_COLS && !found; position++) {
+                if (keycode_at_keymap_location(layer, position / MATRIX_COLS, position % MATRIX_COLS) == fast_combos[combo].keys[i]) {
+                    mask |= POSITION_BIT(position);
+                    found = true;
+                }
+            }
+            complete &= found;
+        }
+        // A combo with a key missing from the layer could never fire.
+        combo_masks[combo] = complete ? mask : 0;
+        for (uint8_t position = 0; position < MATRIX_ROWS * MATRIX_COLS; position++) {
+            if (combo_masks[combo] & POSITION_BIT(position)) position_combos[position] |= (uint32_t)1 << combo;
+        }
+    }
+}
+
+uint16_t fast_combo_keycode(uint8_t combo) {
+    return combo < fast_combos_count ? fast_combos[combo].result : KC_NO;
+}
+
+static void send_combo(uint8_t combo, bool pressed) {
+    keyrecord_t record = {.event = MAKE_KEYEVENT(FAST_COMBO_ROW, combo, pressed)};
+    action_tapping_process(record);
+}
+
+// Hands the held back presses to QMK in their original order and timing.
+static void flush(void) {
+    for (uint8_t i = 0; i < buffered; i++) {
+        action_tapping_process(buffer[i]);
+    }
+    buffered      = 0;
+    buffered_mask = 0;
+    candidates    = 0;
+}
+
+// The candidate whose keys are exactly the buffered ones, if any.
+static uint8_t complete_candidate(void) {
+    for (uint32_t left = candidates; left; left &= left - 1) {
+        uint8_t combo = __builtin_ctz(left);
+        if (combo_masks[combo] == buffered_mask) return combo;
+    }
+    return FAST_COMBO_NONE;
+}
+
+static void fire(uint8_t combo) {
+    active        = combo;
+    active_mask   = buffered_mask;
+    buffered      = 0;
+    buffered_mask = 0;
+    candidates    = 0;
+    send_combo(combo, true);
+}
+
+static bool process_press(keyrecord_t *record) {
+    uint8_t  position = POSITION(record->event.key);
+    uint32_t narrowed = (buffered ? candidates : UINT32_MAX) & position_combos[position];
+
+    if (!narrowed) {
+        if (!buffered) return true;
+        // No combo left: release what was held back, then look at this key
+        // again since it may start a combo of its own.
+        flush();
+        return process_press(record);
+    }
+
+    buffer[buffered++] = *record;
+    buffered_mask |= POSITION_BIT(position);
+    candidates = narrowed;
+
+    // Fire right away unless a longer combo could still complete.
+    uint8_t combo = complete_candidate();
+    if (combo != FAST_COMBO_NONE && !(candidates & ~((uint32_t)1 << combo))) fire(combo);
+    return false;
+}
+
+bool process_fast_combo(keyrecord_t *record) {
+    keypos_t key = record->event.key;
+
+    if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) return true;
+
+    if (!record->event.pressed) {
+        uint64_t bit = POSITION_BIT(POSITION(key));
+        if (active_mask & bit) {
+            active_mask &= ~bit;
+            if (active != FAST_COMBO_NONE) {
+                send_combo(active, false);
+                active = FAST_COMBO_NONE;
+            }
+            return false;
+        }
+        // Any other release ends the wait, so it is processed after the
+        // presses that came before it.
+        if (buffered) flush();
+        return true;
+    }
+
+    if (!buffered && get_highest_layer(layer_state | default_layer_state) != combo_layer) return true;
+    return process_press(record);
+}
+
+void fast_combo_task(void) {
+    if (!buffered || timer_elapsed(buffer[0].event.time) < COMBO_TERM) return;
+
+    uint8_t combo = complete_candidate();
+    if (combo != FAST_COMBO_NONE) {
+        fire(combo);
+    } else {
+        flush();
+    }
+}
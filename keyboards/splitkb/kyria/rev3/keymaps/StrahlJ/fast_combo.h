@@ -0,0 +1,46 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+// Keys per combo and combos in total, the candidate sets are 32-bit masks.
+#define FAST_COMBO_MAX_KEYS 4
+#define FAST_COMBO_MAX 32
+
+// Time the keys of a combo may be pressed apart.
+#ifndef COMBO_TERM
+#    define COMBO_TERM 50
+#endif
+
+// Matrix row of the virtual key a fired combo presses, its column is the
+// combo index. QMK's own virtual keys (KEYLOC_*) use rows 250 to 255.
+#define FAST_COMBO_ROW 249
+
+// Keys are given by their keycodes on the combo layer, the positions are
+// looked up once at init. A combo fires when all its keys are down within
+// COMBO_TERM, and sends `result` until the first of them is released.
+typedef struct {
+    uint16_t keys[FAST_COMBO_MAX_KEYS];
+    uint16_t result;
+} fast_combo_t;
+
+#define FAST_COMBO(res, ...) {.keys = {__VA_ARGS__}, .result = (res)}
+
+// Defined by the keymap.
+extern const fast_combo_t fast_combos[];
+extern const uint8_t      fast_combos_count;
+
+// Builds the position masks from `layer`, combos only trigger while it is the
+// highest active layer. Call once from keyboard_post_init_user().
+void fast_combo_init(uint8_t layer);
+
+// Call from pre_process_record_user(). Returns false if the event was taken.
+bool process_fast_combo(keyrecord_t *record);
+
+// Call from housekeeping_task_user(), resolves combos on COMBO_TERM.
+void fast_combo_task(void);
+
+// Keycode of the virtual key at FAST_COMBO_ROW, for keymap_key_to_keycode().
+uint16_t fast_combo_keycode(uint8_t combo);
@@ -0,0 +1,146 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "raw_hid_commands.h"
+#include "us_timer.h"
+#include "idle_governor.h"
+
+typedef struct {
+    uint32_t count;
+    uint32_t total_us;
+    uint16_t max_us;
+} idle_latency_t;
+
+static idle_state_t state;
+static uint32_t     entered;
+static uint32_t     time_in[IDLE_STATE_COUNT];
+static uint32_t     wakes;
+static bool         waking;
+static uint16_t     last_render;
+#ifdef OLED_ENABLE
+static uint8_t brightness;
+#endif
+
+static uint32_t       scan_us, previous_scan_us;
+static idle_latency_t latency[2]; // presses while active, first press after idle
+
+static idle_state_t target_state(void) {
+    uint32_t idle = last_input_activity_elapsed();
+
+    if (idle >= IDLE_OFF_TIMEOUT) return IDLE_OFF;
+    if (idle >= IDLE_DIM_TIMEOUT) return IDLE_DIM;
+    return IDLE_ACTIVE;
+}
+
+static void enter(idle_state_t next) {
+    time_in[state] += timer_elapsed32(entered);
+    entered = timer_read32();
+
+#ifdef OLED_ENABLE
+    if (state == IDLE_ACTIVE) brightness = oled_get_brightness();
+    switch (next) {
+        case IDLE_ACTIVE:
+            oled_set_brightness(brightness);
+            oled_on();
+            break;
+        case IDLE_DIM:
+            oled_set_brightness(IDLE_DIM_BRIGHTNESS);
+            oled_on();
+            break;
+        default:
+            oled_off();
+            break;
+    }
+#endif
+    if (next == IDLE_ACTIVE) wakes++;
+    waking = false;
+    state  = next;
+}
+
+void idle_governor_task(void) {
+    idle_state_t next = target_state();
+
+    if (next != state) enter(next);
+
+#if defined(IDLE_SCAN_SLEEP) && IDLE_SCAN_SLEEP > 0
+    // On ChibiOS this sleeps the main thread instead of spinning.
+    if (state == IDLE_OFF) wait_ms(IDLE_SCAN_SLEEP);
+#endif
+}
+
+idle_state_t idle_governor_state(void) {
+    return state;
+}
+
+bool idle_governor_render_due(void) {
+    switch (state) {
+        case IDLE_ACTIVE:
+            return true;
+        case IDLE_DIM:
+            if (timer_elapsed(last_render) < IDLE_DIM_RENDER_INTERVAL) return false;
+            last_render = timer_read();
+            return true;
+        default:
+            // Drawing would mark blocks dirty, and rendering them turns the OLED back on.
+            return false;
+    }
+}
+
+void idle_governor_scan(void) {
+    previous_scan_us = scan_us;
+    scan_us          = us_timer_read();
+}
+
+// A press was not there in the previous scan, so it happened at most this long ago.
+void idle_governor_key(keyrecord_t *record) {
+    if (!record->event.pressed) return;
+
+    bool            wake  = state != IDLE_ACTIVE && !waking;
+    idle_latency_t *stat  = &latency[wake];
+    uint32_t        delay = us_timer_read() - previous_scan_us;
+
+    if (state != IDLE_ACTIVE) waking = true;
+    stat->count++;
+    stat->total_us += delay;
+    if (delay > stat->max_us) stat->max_us = delay > UINT16_MAX ? UINT16_MAX : delay;
+}
+
+void idle_governor_reset(void) {
+    memset(time_in, 0, sizeof(time_in));
+    memset(latency, 0, sizeof(latency));
+    wakes   = 0;
+    entered = timer_read32();
+}
+
+#ifdef RAW_ENABLE
+static uint16_t average_us(const idle_latency_t *stat) {
+    uint32_t average = stat->count ? stat->total_us / stat->count : 0;
+    return average > UINT16_MAX ? UINT16_MAX : average;
+}
+
+// RAW_HID_IDLE_STATS answers [cmd][state][ms active, dimmed, off u32 each][wakes u32]
+// [active press avg us u16][max us u16][first press after idle avg us u16][max us u16].
+bool idle_governor_raw_hid_receive(uint8_t *data, uint8_t length) {
+    switch (data[0]) {
+        case RAW_HID_IDLE_STATS:
+            data[1] = state;
+            for (uint8_t i = 0; i < IDLE_STATE_COUNT; i++) {
+                raw_hid_put_u32(data + 2 + 4 * i, time_in[i] + (i == state ? timer_elapsed32(entered) : 0));
+            }
+            raw_hid_put_u32(data + 14, wakes);
+            for (uint8_t i = 0; i < 2; i++) {
+                raw_hid_put_u16(data + 18 + 4 * i, average_us(&latency[i]));
+                raw_hid_put_u16(data + 20 + 4 * i, latency[i].max_us);
+            }
+            break;
+        case RAW_HID_IDLE_RESET:
+            idle_governor_reset();
+            break;
+        default:
+            return false;
+    }
+    raw_hid_send(data, length);
+    return true;
+}
+#endif
@@ -0,0 +1,51 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+// Idle periods in ms since the last key press or release on either half.
+#ifndef IDLE_DIM_TIMEOUT
+#    define IDLE_DIM_TIMEOUT 30000
+#endif
+#ifndef IDLE_OFF_TIMEOUT
+#    define IDLE_OFF_TIMEOUT 300000
+#endif
+
+// OLED contrast while dimmed, and how often the dimmed screens are redrawn.
+#ifndef IDLE_DIM_BRIGHTNESS
+#    define IDLE_DIM_BRIGHTNESS 16
+#endif
+#ifndef IDLE_DIM_RENDER_INTERVAL
+#    define IDLE_DIM_RENDER_INTERVAL 1000
+#endif
+
+typedef enum {
+    IDLE_ACTIVE, // full brightness, redrawn every loop
+    IDLE_DIM,    // dimmed, redrawn every IDLE_DIM_RENDER_INTERVAL
+    IDLE_OFF,    // OLEDs off, nothing is drawn or synced
+    IDLE_STATE_COUNT,
+} idle_state_t;
+
+// Moves between the stages, call first thing in housekeeping_task_user().
+// All display changes happen here, so the key that ends an idle period is
+// processed exactly like any other key and the screens follow one loop later.
+void idle_governor_task(void);
+
+idle_state_t idle_governor_state(void);
+
+// Returns false when oled_task_user() should skip this pass.
+bool idle_governor_render_due(void);
+
+// Latency of key presses from the scan before they were seen until they
+// reach pre_process_record_user(), kept apart for the first press after idle.
+// Call from matrix_scan_user() and pre_process_record_user() respectively.
+void idle_governor_scan(void);
+void idle_governor_key(keyrecord_t *record);
+
+void idle_governor_reset(void);
+
+#ifdef RAW_ENABLE
+bool idle_governor_raw_hid_receive(uint8_t *data, uint8_t length);
+#endif
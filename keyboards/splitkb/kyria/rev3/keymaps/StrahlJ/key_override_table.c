@@ -0,0 +1,184 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "key_override_table.h"
+
+// Folds right-hand modifier bits onto the left-hand ones.
+#define MODS_FOLD(mods) (((mods) | ((mods) >> 4)) & 0x0F)
+#define MODS_UNFOLD(mods) ((mods) | ((mods) << 4))
+
+// Index from trigger keycode to the first matching rule, then a chain through
+// the rules sharing that trigger. Entries are rule index + 1, 0 ends the chain.
+// Keys without an override cost one table read, and a chain is only walked
+// while some trigger modifier is held. C can't derive the index from
+// key_override_rules[] at compile time, so it is built at boot and costs
+// 256 + KEY_OVERRIDE_TABLE_MAX bytes of RAM.
+static uint8_t first_rule[QK_BASIC_MAX + 1];
+static uint8_t next_rule[KEY_OVERRIDE_TABLE_MAX];
+static uint8_t trigger_mods_union;
+
+// The override being sent, and the held mods it took out of the report.
+static const key_override_rule_t *active_rule;
+static uint8_t                    suppressed_mods;
+
+// The most recently pressed key, while it is held and triggers any rule, so
+// that a modifier pressed after it can still activate an override.
+static keypos_t trigger_key;
+static uint16_t trigger_keycode;
+
+void key_override_table_init(void) {
+    memset(first_rule, 0, sizeof(first_rule));
+    trigger_mods_union = 0;
+
+    // Walk backwards so each chain keeps the order of key_override_rules[].
+    for (int16_t i = MIN(key_override_rules_count, KEY_OVERRIDE_TABLE_MAX) - 1; i >= 0; i--) {
+        uint16_t trigger = key_override_rules[i].trigger;
+        if (trigger > QK_BASIC_MAX) {
+            dprintf("key override %d: trigger 0x%04X is not a basic keycode\n", i, trigger);
+            continue;
+        }
+        next_rule[i]        = first_rule[trigger];
+        first_rule[trigger] = i + 1;
+        trigger_mods_union |= MODS_FOLD(key_override_rules[i].trigger_mods);
+    }
+}
+
+// Modifier bits a key holds: modifier keys, and mod-taps and one-shot mods
+// held past their tap. Other keys hold none.
+static uint8_t held_mods(uint16_t keycode, keyrecord_t *record) {
+    uint8_t mods;
+
+    if (IS_MODIFIER_KEYCODE(keycode)) {
+        return MOD_BIT(keycode);
+    }
+    if (IS_QK_MOD_TAP(keycode) && record->tap.count == 0) {
+        mods = QK_MOD_TAP_GET_MODS(keycode);
+    } else if (IS_QK_ONE_SHOT_MOD(keycode) && record->tap.count == 0) {
+        mods = QK_ONE_SHOT_MOD_GET_MODS(keycode);
+    } else {
+        return 0;
+    }
+    return (mods & 0x10) ? (mods & 0x0F) << 4 : mods;
+}
+
+static const key_override_rule_t *find_rule(uint16_t keycode, uint8_t mods) {
+    uint8_t folded = MODS_FOLD(mods);
+    if (!(folded & trigger_mods_union)) {
+        return NULL;
+    }
+
+    for (uint8_t i = first_rule[keycode]; i != 0; i = next_rule[i - 1]) {
+        const key_override_rule_t *rule         = &key_override_rules[i - 1];
+        uint8_t                    trigger_mods = MODS_FOLD(rule->trigger_mods);
+        if ((folded & trigger_mods) == trigger_mods) {
+            return rule;
+        }
+    }
+    return NULL;
+}
+
+// Takes the trigger mods out of the report and sends the replacement. The
+// held ones come back when the override ends, one-shot mods are used up.
+static void activate(const key_override_rule_t *rule, uint8_t mods) {
+    uint8_t suppressed = mods & MODS_UNFOLD(MODS_FOLD(rule->trigger_mods));
+    suppressed_mods    = get_mods() & suppressed;
+    active_rule        = rule;
+    del_mods(suppressed);
+    del_oneshot_mods(suppressed);
+    register_code16(rule->replacement);
+}
+
+// Releases the replacement before the mods come back, so the host never sees
+// them together. With `reregister` a trigger still held is pressed again.
+static void deactivate(bool reregister) {
+    unregister_code16(active_rule->replacement);
+    add_mods(suppressed_mods);
+    active_rule = NULL;
+    if (reregister && trigger_keycode) {
+        register_code(trigger_keycode);
+    } else {
+        send_keyboard_report();
+    }
+}
+
+static bool process_mod_press(uint8_t mods) {
+    if (active_rule) {
+        // More of the trigger mods stay out of the report too, anything else
+        // is added to the replacement.
+        uint8_t suppressed = mods & MODS_UNFOLD(MODS_FOLD(active_rule->trigger_mods));
+        if (!suppressed) {
+            return true;
+        }
+        suppressed_mods |= suppressed;
+        add_mods(mods & ~suppressed);
+        send_keyboard_report();
+        return false;
+    }
+    if (!trigger_keycode) {
+        return true;
+    }
+
+    // A modifier pressed while the trigger is held, as in Bksp then Shift.
+    const key_override_rule_t *rule = find_rule(trigger_keycode, get_mods() | get_oneshot_mods() | mods);
+    if (!rule) {
+        return true;
+    }
+    unregister_code(trigger_keycode);
+    add_mods(mods);
+    activate(rule, get_mods() | get_oneshot_mods());
+    return false;
+}
+
+static void process_mod_release(uint8_t mods) {
+    if (!active_rule) {
+        return;
+    }
+    suppressed_mods &= ~mods;
+
+    uint8_t trigger_mods = MODS_FOLD(active_rule->trigger_mods);
+    if ((MODS_FOLD((get_mods() | suppressed_mods) & ~mods) & trigger_mods) != trigger_mods) {
+        deactivate(true);
+    }
+}
+
+bool process_key_override_table(uint16_t keycode, keyrecord_t *record) {
+    uint8_t mods = held_mods(keycode, record);
+    if (mods) {
+        if (record->event.pressed) {
+            return process_mod_press(mods);
+        }
+        process_mod_release(mods);
+        return true;
+    }
+
+    if (!record->event.pressed) {
+        if (trigger_keycode && KEYEQ(record->event.key, trigger_key)) {
+            trigger_keycode = 0;
+            if (active_rule) {
+                deactivate(false);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Any other key ends the override and is typed with the mods held.
+    if (active_rule) {
+        deactivate(false);
+    }
+    trigger_keycode = 0;
+    if (keycode > QK_BASIC_MAX || !first_rule[keycode]) {
+        return true;
+    }
+    trigger_key     = record->event.key;
+    trigger_keycode = keycode;
+
+    uint8_t                    held = get_mods() | get_oneshot_mods();
+    const key_override_rule_t *rule = find_rule(keycode, held);
+    if (!rule) {
+        return true;
+    }
+    activate(rule, held);
+    return false;
+}
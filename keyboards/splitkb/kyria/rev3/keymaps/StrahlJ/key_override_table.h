@@ -0,0 +1,38 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+// Most rules key_override_rules[] may hold, at most 254.
+#ifndef KEY_OVERRIDE_TABLE_MAX
+#    define KEY_OVERRIDE_TABLE_MAX 64
+#endif
+
+// A basic override: while any of `trigger_mods` is held, `trigger` sends
+// `replacement` instead, with the trigger mods suppressed. Left and right
+// modifiers are treated alike, and one-shot mods count as held.
+//
+// As with QMK's key overrides, a rule activates when its trigger is pressed
+// with the mods held or the mods are pressed while the trigger is held. It
+// ends when the trigger is released, when a trigger mod is released (a trigger
+// still held is then pressed again), or when any other key is pressed, which
+// is then typed with the held mods back in place.
+typedef struct {
+    uint8_t  trigger_mods;
+    uint16_t trigger;
+    uint16_t replacement;
+} key_override_rule_t;
+
+#define ko_rule(mods, trigger_key, replacement_key) {.trigger_mods = (mods), .trigger = (trigger_key), .replacement = (replacement_key)}
+
+// Defined by the keymap. Triggers must be basic keycodes.
+extern const key_override_rule_t key_override_rules[];
+extern const uint8_t             key_override_rules_count;
+
+// Builds the per-keycode index, call once from keyboard_post_init_user().
+void key_override_table_init(void);
+
+// Call first in process_record_user(). Returns false if the event was consumed.
+bool process_key_override_table(uint16_t keycode, keyrecord_t *record);
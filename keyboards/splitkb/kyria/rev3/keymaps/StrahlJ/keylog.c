@@ -0,0 +1,123 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "raw_hid_commands.h"
+#include "us_timer.h"
+#include "keylog.h"
+
+static keylog_entry_t entries[KEYLOG_SIZE];
+static uint16_t       head;  // next slot to write
+static uint16_t       count; // valid entries, at most KEYLOG_SIZE
+static uint32_t       overwritten;
+static bool           recording;
+static matrix_row_t   previous[MATRIX_ROWS];
+
+static void keylog_add(uint32_t now, uint8_t row, uint8_t col, bool pressed) {
+    keylog_entry_t *entry = &entries[head];
+
+    entry->time_us             = now;
+    entry->row                 = row;
+    entry->col_pressed         = col | (pressed ? KEYLOG_PRESSED : 0);
+    entry->layer_state         = layer_state;
+    entry->mods                = get_mods();
+    entry->oneshot_mods        = get_oneshot_mods();
+    entry->oneshot_locked_mods = get_oneshot_locked_mods();
+    entry->flags               = 0;
+#ifdef CAPS_WORD_ENABLE
+    if (is_caps_word_on()) entry->flags |= KEYLOG_FLAG_CAPS_WORD;
+#endif
+#ifdef LEADER_ENABLE
+    if (leader_sequence_active()) entry->flags |= KEYLOG_FLAG_LEADER;
+#endif
+
+    head = head + 1 < KEYLOG_SIZE ? head + 1 : 0;
+    if (count < KEYLOG_SIZE) {
+        count++;
+    } else {
+        overwritten++;
+    }
+}
+
+// matrix_scan_user() runs at the end of every scan, before the changes are
+// turned into key events. While idle this is one compare per row; the state
+// is only read when a row actually changed.
+void keylog_scan(void) {
+    if (!recording) return;
+
+    uint32_t now = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t current = matrix_get_row(row);
+        matrix_row_t changes = current ^ previous[row];
+        if (!changes) continue;
+
+        if (!now) now = us_timer_read();
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (changes & ((matrix_row_t)1 << col)) {
+                keylog_add(now, row, col, current & ((matrix_row_t)1 << col));
+            }
+        }
+        previous[row] = current;
+    }
+}
+
+static void keylog_start(void) {
+    // Keys already held when recording starts are not reported as presses.
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        previous[row] = matrix_get_row(row);
+    }
+    recording = true;
+}
+
+void keylog_toggle(void) {
+    if (recording) {
+        recording = false;
+    } else {
+        keylog_start();
+    }
+}
+
+// RAW_HID_KEYLOG_STATUS answers [cmd][recording][count u16][size u16][overwritten u32]
+// [rows][cols], the matrix size the positions refer to.
+// RAW_HID_KEYLOG_READ [index u16] answers [cmd][count u16][index u16] followed by up
+// to two entries, oldest first. Stop recording before reading so indices stay put.
+bool keylog_raw_hid_receive(uint8_t *data, uint8_t length) {
+    switch (data[0]) {
+        case RAW_HID_KEYLOG_START:
+            keylog_start();
+            break;
+        case RAW_HID_KEYLOG_STOP:
+            recording = false;
+            break;
+        case RAW_HID_KEYLOG_CLEAR:
+            head        = 0;
+            count       = 0;
+            overwritten = 0;
+            break;
+        case RAW_HID_KEYLOG_STATUS:
+            data[1] = recording;
+            raw_hid_put_u16(data + 2, count);
+            raw_hid_put_u16(data + 4, KEYLOG_SIZE);
+            raw_hid_put_u32(data + 6, overwritten);
+            data[10] = MATRIX_ROWS;
+            data[11] = MATRIX_COLS;
+            break;
+        case RAW_HID_KEYLOG_READ: {
+            uint16_t index = data[1] | data[2] << 8;
+            uint16_t first = count < KEYLOG_SIZE ? 0 : head;
+            uint8_t  n     = 0;
+
+            memset(data + 1, 0, length - 1);
+            for (; n < (length - 5) / sizeof(keylog_entry_t) && index + n < count; n++) {
+                memcpy(data + 5 + n * sizeof(keylog_entry_t), &entries[(first + index + n) % KEYLOG_SIZE], sizeof(keylog_entry_t));
+            }
+            raw_hid_put_u16(data + 1, count);
+            raw_hid_put_u16(data + 3, index);
+            break;
+        }
+        default:
+            return false;
+    }
+    raw_hid_send(data, length);
+    return true;
+}
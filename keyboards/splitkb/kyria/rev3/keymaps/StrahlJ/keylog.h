@@ -0,0 +1,39 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+// Number of events kept, the oldest ones are overwritten when it is full.
+#ifndef KEYLOG_SIZE
+#    define KEYLOG_SIZE 512
+#endif
+
+// One physical key change as seen by the matrix scan, before tapping, combos
+// or any other processing. The state fields are taken before the event is
+// processed, which is what a replay needs to start from. 12 bytes, little
+// endian, sent as is over raw HID.
+typedef struct __attribute__((packed)) {
+    uint32_t time_us;
+    uint8_t  row;
+    uint8_t  col_pressed; // column in bits 0-6, bit 7 set on press
+    uint16_t layer_state;
+    uint8_t  mods;
+    uint8_t  oneshot_mods;
+    uint8_t  oneshot_locked_mods;
+    uint8_t  flags; // KEYLOG_FLAG_*
+} keylog_entry_t;
+
+_Static_assert(sizeof(keylog_entry_t) == 12, "keylog_entry_t must stay 12 bytes, tools/keylog_dump.py depends on it");
+
+#define KEYLOG_PRESSED 0x80
+#define KEYLOG_FLAG_CAPS_WORD 0x01
+#define KEYLOG_FLAG_LEADER 0x02
+
+// Call from matrix_scan_user(), records nothing unless recording was started.
+void keylog_scan(void);
+
+void keylog_toggle(void);
+
+bool keylog_raw_hid_receive(uint8_t *data, uint8_t length);
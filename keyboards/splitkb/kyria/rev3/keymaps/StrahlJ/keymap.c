@@ -17,6 +17,24 @@
 #include "keymap_german.h"
 #include "sendstring_german.h"
 #include "autocorrect_data.h"
+#include "bitmap_rle.h"
+#include "kyria_logo.h"
+#include "key_override_table.h"
+#include "leader_table.h"
+#include "profile.h"
+#include "keylog.h"
+#include "layer_cache.h"
+#include "fast_combo.h"
+#include "dyn_macro.h"
+#include "user_data.h"
+#include "status_state.h"
+#include "status_sync.h"
+#include "idle_governor.h"
+#include "mouse_engine.h"
+#include "typing_stats.h"
+#include "unicode_fast.h"
+#include "ac_overlay.h"
+#include "raw_hid_commands.h"
 
 enum layers {
     _QWERTZ = 0,
@@ -190,7 +208,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
 //  * Mouse Layer
 //  *
 //  * ,-------------------------------------------.                              ,-------------------------------------------.
-//  * |        |      |      |      |      |      |                              |WHL L | WHL D| WHL U|WHL R|      |        |
+//  * |        |      | SLOW | MID  | FAST |      |                              |WHL L | WHL D| WHL U|WHL R|      |        |
 //  * |--------+------+------+------+------+------|                              |------+------+------+------+------+--------|
 //  * |        |      | RBTN | MBTN | LBTN |      |                              |Left  | Down |  Up  | Rght |      |        |
 //  * |--------+------+------+------+------+------+-------------.  ,-------------+------+------+------+------+------+--------|
@@ -201,7 +219,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
 //  *                        `----------------------------------'  `----------------------------------'
 //  */
      [_MOUSE] = LAYOUT(
-       _______, _______, _______, _______, _______, _______,                                     MS_WHLL, MS_WHLD, MS_WHLU, MS_WHLR, _______, _______,
+       _______, _______, MS_ACL0, MS_ACL1, MS_ACL2, _______,                                     MS_WHLL, MS_WHLD, MS_WHLU, MS_WHLR, _______, _______,
        _______, _______, MS_BTN2, MS_BTN3, MS_BTN1, _______,                                     MS_LEFT, MS_DOWN, MS_UP, MS_RGHT, _______, _______,
        _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______,
                                   _______, _______, _______, _______, _______, _______, _______, _______, _______, _______
@@ -230,7 +248,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
 };
 
 // Caps Word
-bool caps_word_press_user(uint16_t keycode) {
+static bool caps_word_continues(uint16_t keycode) {
     switch (keycode) {
         // Keycodes that continue Caps Word, with shift applied.
         case DE_A ... DE_Z:
@@ -250,55 +268,242 @@ bool caps_word_press_user(uint16_t keycode) {
     }
 }
 
-// Combos
-// const uint16_t PROGMEM sz_combo[] = {DE_S, DE_Z, COMBO_END};
-// const uint16_t PROGMEM aoe_combo[] = {DE_A, DE_ODIA, COMBO_END};
-// const uint16_t PROGMEM uoe_combo[] = {DE_U, DE_ODIA, COMBO_END};
-//
-// combo_t key_combos[] = {
-//     COMBO(sz_combo, DE_SS),
-//     COMBO(aoe_combo, DE_ADIA),
-//     COMBO(uoe_combo, DE_UDIA),
-// };
-
-// Overrides
-const key_override_t delete_key_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
-const key_override_t back_ko = ko_make_basic(MOD_MASK_CTRL, KC_LEFT, KC_WBAK);
-const key_override_t fwd_ko = ko_make_basic(MOD_MASK_CTRL, KC_RIGHT, KC_WFWD);
-const key_override_t refresh_ko = ko_make_basic(MOD_MASK_CTRL, KC_DOWN, KC_WREF);
-const key_override_t br_up_ko = ko_make_basic(MOD_MASK_CTRL, KC_VOLU, KC_BRIU);
-const key_override_t br_dwn_ko = ko_make_basic(MOD_MASK_CTRL, KC_VOLD, KC_BRID);
-
-// This globally defines all key overrides to be used
-const key_override_t *key_overrides[] = {
-	&delete_key_override,
-    &back_ko,
-    &fwd_ko,
-    &refresh_ko,
-    &br_up_ko,
-    &br_dwn_ko
+bool caps_word_press_user(uint16_t keycode) {
+    PROFILE_BEGIN(PROFILE_CAPS_WORD);
+    bool continues = caps_word_continues(keycode);
+    PROFILE_END(PROFILE_CAPS_WORD);
+    return continues;
+}
+
+// Tap-hold
+// Faster typing means shorter taps, so the hold decision can come sooner. The
+// thumb's Enter is the exception: it ends a line or a message rather than a
+// streak, and is often held longer than the faster term even mid-streak.
+uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    if (keycode == ALT_ENT) {
+        return TAPPING_TERM;
+    }
+    uint8_t wpm = MIN(get_current_wpm(), TAPPING_TERM_FAST_WPM);
+    return TAPPING_TERM - (uint16_t)wpm * (TAPPING_TERM - TAPPING_TERM_FAST) / TAPPING_TERM_FAST_WPM;
+}
+
+// Each half has four matrix rows, the last one of them holds the thumb keys.
+// Thumbs are exempt so e.g. ALT_ENT still works with keys on its own side.
+char chordal_hold_handedness(keypos_t key) {
+    if (key.row % (MATRIX_ROWS / 2) == MATRIX_ROWS / 2 - 1) {
+        return '*';
+    }
+    return key.row < MATRIX_ROWS / 2 ? 'L' : 'R';
+}
+
+// QMK's default only lets letters and a few symbols flow tap, which leaves
+// out all four mod-taps. They follow a letter within FLOW_TAP_TERM as taps.
+uint16_t get_flow_tap_term(uint16_t keycode, keyrecord_t *record, uint16_t prev_keycode) {
+    switch (keycode) {
+        case CTL_ESC:
+        case CTL_QUOT:
+        case CTL_MINS:
+        case ALT_ENT:
+            return is_flow_tap_key(prev_keycode) ? FLOW_TAP_TERM : 0;
+    }
+    return 0;
+}
+
+// Ctrl/Esc is also the Ctrl for Ctrl+C, V, X, Y, A and S on its own hand,
+// so it may be held with keys from either hand.
+bool get_chordal_hold(uint16_t tap_hold_keycode, keyrecord_t *tap_hold_record, uint16_t other_keycode, keyrecord_t *other_record) {
+    if (tap_hold_keycode == CTL_ESC) {
+        return true;
+    }
+    return get_chordal_hold_default(tap_hold_record, other_record);
+}
+
+// Combos, matched on matrix positions in fast_combo.c
+const fast_combo_t fast_combos[] = {
+    FAST_COMBO(DE_SS,   DE_S, DE_Z),
+    FAST_COMBO(DE_ADIA, DE_A, DE_ODIA),
+    FAST_COMBO(DE_UDIA, DE_U, DE_ODIA),
+};
+const uint8_t fast_combos_count = ARRAY_SIZE(fast_combos);
+
+// Overrides, looked up by trigger keycode in key_override_table.c
+const key_override_rule_t key_override_rules[] = {
+    ko_rule(MOD_MASK_SHIFT, KC_BSPC,  KC_DEL),
+    ko_rule(MOD_MASK_CTRL,  KC_LEFT,  KC_WBAK),
+    ko_rule(MOD_MASK_CTRL,  KC_RIGHT, KC_WFWD),
+    ko_rule(MOD_MASK_CTRL,  KC_DOWN,  KC_WREF),
+    ko_rule(MOD_MASK_CTRL,  KC_VOLU,  KC_BRIU),
+    ko_rule(MOD_MASK_CTRL,  KC_VOLD,  KC_BRID),
 };
+const uint8_t key_override_rules_count = ARRAY_SIZE(key_override_rules);
 
 // Leader
+const leader_sequence_t leader_sequences[] = {
+    {LEADER_KEYS(KC_L, KC_K),       LEADER_STRING("loadkeys de-latin1")},
+    {LEADER_KEYS(DE_M, DE_R),       LEADER_DYNAMIC_MACRO(DM_REC1)},
+    {LEADER_KEYS(DE_M, DE_M, DE_R), LEADER_DYNAMIC_MACRO(DM_REC2)},
+    {LEADER_KEYS(DE_M, DE_P),       LEADER_DYNAMIC_MACRO(DM_PLY1)},
+    {LEADER_KEYS(DE_M, DE_M, DE_P), LEADER_DYNAMIC_MACRO(DM_PLY2)},
+    {LEADER_KEYS(DE_M, DE_S),       LEADER_DYNAMIC_MACRO(DM_RSTP)},
+    {LEADER_KEYS(DE_S, DE_S),       LEADER_UNICODE(SNEK)},
+    {LEADER_KEYS(DE_M, DE_F, DE_G), LEADER_UNICODE_STRING("Mit freundlichen Grüßen")},
+    {LEADER_KEYS(DE_A, DE_L),       LEADER_CALL(ac_overlay_learn)},
+#ifdef PROFILE_ENABLE
+    {LEADER_KEYS(DE_P, DE_D),       LEADER_CALL(profile_print)},
+    {LEADER_KEYS(DE_P, DE_R),       LEADER_CALL(profile_reset)},
+    {LEADER_KEYS(DE_P, DE_O),       LEADER_CALL(profile_oled_page_toggle)},
+#endif
+#ifdef KEYLOG_ENABLE
+    {LEADER_KEYS(DE_K, DE_R),       LEADER_CALL(keylog_toggle)},
+#endif
+};
+const uint8_t leader_sequences_count = ARRAY_SIZE(leader_sequences);
+
+void leader_start_user(void) {
+    leader_table_start();
+}
+
 void leader_end_user(void) {
-    if (leader_sequence_two_keys(KC_L, KC_K)) {
-        SEND_STRING("loadkeys de-latin1");
-    } else if (leader_sequence_two_keys(DE_M, DE_R)) {
-        tap_code16(DM_REC1);
-    } else if (leader_sequence_three_keys(DE_M, DE_M, DE_R)) {
-        tap_code16(DM_REC2);
-    } else if (leader_sequence_two_keys(DE_M, DE_P)) {
-        tap_code16(DM_PLY1);
-    } else if (leader_sequence_three_keys(DE_M, DE_M, DE_P)) {
-        tap_code16(DM_PLY2);
-    } else if (leader_sequence_two_keys(DE_M, DE_S)) {
-        tap_code16(DM_RSTP);
-    } else if (leader_sequence_two_keys(DE_S, DE_S)) {
-        tap_code16(UM(SNEK));
+    PROFILE_BEGIN(PROFILE_LEADER);
+    leader_table_end();
+    PROFILE_END(PROFILE_LEADER);
+}
+
+void keyboard_post_init_user(void) {
+    key_override_table_init();
+    leader_table_init();
+    layer_cache_init();
+    fast_combo_init(_QWERTZ);
+    user_data_init();
+    dyn_macro_init();
+    typing_stats_init();
+    ac_overlay_init();
+    status_sync_init();
+}
+
+layer_state_t layer_state_set_user(layer_state_t state) {
+    layer_cache_invalidate();
+    return state;
+}
+
+layer_state_t default_layer_state_set_user(layer_state_t state) {
+    layer_cache_invalidate();
+    return state;
+}
+
+void matrix_scan_user(void) {
+    idle_governor_scan();
+#ifdef PROFILE_ENABLE
+    profile_scan_tick();
+#endif
+#ifdef KEYLOG_ENABLE
+    if (is_keyboard_master()) keylog_scan();
+#endif
+}
+
+#ifdef OLED_ENABLE
+// What the master's status screen shows, captured by housekeeping_task_user().
+static status_state_t status_now;
+#endif
+
+void housekeeping_task_user(void) {
+    idle_governor_task();
+    fast_combo_task();
+    mouse_engine_task();
+    typing_stats_task();
+    ac_overlay_task();
+    dyn_macro_task();
+#ifdef OLED_ENABLE
+    // Captured once per loop, rendered by oled_task_user() here and on the
+    // slave through status_sync.c.
+    if (is_keyboard_master() && idle_governor_state() != IDLE_OFF) {
+        status_capture(&status_now);
+        status_sync_task(&status_now);
+    }
+#endif
+#ifdef PROFILE_ENABLE
+    profile_task();
+#endif
+}
+
+bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    typing_stats_autocorrect();
+    ac_overlay_forget();
+    return true;
+}
+
+bool process_autocorrect_user(uint16_t *keycode, keyrecord_t *record, uint8_t *typo_buffer_size, uint8_t *mods) {
+    ac_overlay_autocorrect_user(typo_buffer_size);
+    return process_autocorrect_default_handler(keycode, record, typo_buffer_size, mods);
+}
+
+bool pre_process_record_user(uint16_t keycode, keyrecord_t *record) {
+    idle_governor_key(record);
+    typing_stats_key(record);
+    return process_fast_combo(record);
+}
+
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+#ifdef PROFILE_ENABLE
+    // A mod-tap press only arrives here once it is settled as tap or hold.
+    if (IS_QK_MOD_TAP(keycode) && record->event.pressed) {
+        profile_add(PROFILE_TAP_HOLD, timer_elapsed(record->event.time));
+    }
+#endif
+    PROFILE_BEGIN(PROFILE_RECORD);
+    if (!process_dyn_macro(keycode, record)) {
+        PROFILE_END(PROFILE_RECORD);
+        return false;
+    }
+    PROFILE_BEGIN(PROFILE_KEY_OVERRIDE);
+    bool handled = !process_key_override_table(keycode, record);
+    PROFILE_END(PROFILE_KEY_OVERRIDE);
+    if (handled || !process_mouse_engine(keycode, record)) {
+        PROFILE_END(PROFILE_RECORD);
+        return false;
     }
+#ifdef UNICODEMAP_ENABLE
+    if (!process_unicode_fast(keycode, record)) {
+        PROFILE_END(PROFILE_RECORD);
+        return false;
+    }
+#endif
+    // The overlay's rules go first: QMK's own autocorrect only runs after
+    // process_record_user() and can't swallow the key that completes a typo.
+    if (!process_ac_overlay(keycode, record)) {
+        PROFILE_END(PROFILE_RECORD);
+        return false;
+    }
+    leader_table_record(keycode, record);
+    PROFILE_END(PROFILE_RECORD);
+    // Ends in post_process_record_user(), unless a later handler consumes the key.
+    PROFILE_BEGIN(PROFILE_QUANTUM_TAIL);
+    return true;
+}
 
+void post_process_record_user(uint16_t keycode, keyrecord_t *record) {
+    PROFILE_END(PROFILE_QUANTUM_TAIL);
+}
 
+// Every raw HID report goes to the modules in turn, the first one that knows
+// the command answers it.
+#ifdef RAW_ENABLE
+void raw_hid_receive(uint8_t *data, uint8_t length) {
+#    ifdef PROFILE_ENABLE
+    if (profile_raw_hid_receive(data, length)) return;
+#    endif
+#    ifdef KEYLOG_ENABLE
+    if (keylog_raw_hid_receive(data, length)) return;
+#    endif
+    if (status_sync_raw_hid_receive(data, length)) return;
+    if (idle_governor_raw_hid_receive(data, length)) return;
+    if (typing_stats_raw_hid_receive(data, length)) return;
+    if (ac_overlay_raw_hid_receive(data, length)) return;
+    if (unicode_fast_raw_hid_receive(data, length)) return;
+    data[0] = RAW_HID_UNHANDLED;
+    raw_hid_send(data, length);
 }
+#endif
 
 /* The default OLED and rotary encoder code can be found at the bottom of qmk_firmware/keyboards/splitkb/kyria/rev1/rev1.c
  * These default settings can be overriden by your own settings in your keymap.c
@@ -310,73 +515,258 @@ void leader_end_user(void) {
 // #ifdef OLED_ENABLE
 oled_rotation_t oled_init_user(oled_rotation_t rotation) { return OLED_ROTATION_180; }
 
-void render_status(void) {
-    // Host Keyboard Layer Status
-    oled_write_P(PSTR("Layer: "), false);
-    switch (get_highest_layer(layer_state|default_layer_state)) {
+#ifdef OLED_BYTES_MONITOR
+// Bytes handed to the OLED buffer by this keymap, latched once per second.
+// The driver only flushes dirty blocks, so this is an upper bound for the I2C traffic.
+static uint32_t oled_bytes_written;
+static uint32_t oled_bytes_rate;
+static uint16_t oled_bytes_timer;
+static uint8_t  oled_bytes_digits[5];
+#    define OLED_COUNT_BYTES(n) (oled_bytes_written += (n))
+#else
+#    define OLED_COUNT_BYTES(n) ((void)(n))
+#endif
+
+// Last state drawn by render_status(). Every field is only rewritten when it
+// differs from what is already in the OLED buffer, so an unchanged status costs
+// a handful of compares per frame instead of a full redraw.
+typedef struct {
+    bool    drawn;
+    uint8_t layer;
+    uint8_t oneshot_mods;
+    bool    caps_word;
+    bool    leader;
+    bool    autocorrect;
+    uint8_t learn;
+    led_t   leds;
+    uint8_t wpm_digits[3];
+#ifdef DEBUG_MATRIX_SCAN_RATE
+    uint8_t scan_digits[5];
+#endif
+} status_snapshot_t;
+
+static status_snapshot_t status_shown;
+
+static void oled_write_field_P(uint8_t col, uint8_t line, const char *data) {
+    oled_set_cursor(col, line);
+    oled_write_P(data, false);
+}
+
+// Writes `value` as a zero padded decimal number of `width` digits, touching
+// only the character cells whose digit changed since the last call.
+static void oled_write_digits(uint8_t col, uint8_t line, uint8_t *shown, uint8_t width, uint32_t value) {
+    for (int8_t i = width - 1; i >= 0; i--) {
+        uint8_t digit = value % 10;
+        value /= 10;
+        if (shown[i] != digit) {
+            shown[i] = digit;
+            oled_set_cursor(col + i, line);
+            oled_write_char('0' + digit, false);
+            OLED_COUNT_BYTES(OLED_FONT_WIDTH);
+        }
+    }
+}
+
+static const char *learn_state_P(uint8_t learn) {
+    // Padded to the same width, like the layer names.
+    switch (learn) {
+        case AC_OVERLAY_LEARN_TYPO:
+            return PSTR("Learn typo  ");
+        case AC_OVERLAY_LEARN_CORRECTION:
+            return PSTR("Learn fix   ");
+        case AC_OVERLAY_LEARN_SAVING:
+            return PSTR("Saving rule ");
+        case AC_OVERLAY_LEARN_LEARNED:
+            return PSTR("Rule learned");
+        case AC_OVERLAY_LEARN_FAILED:
+            return PSTR("Overlay full");
+        case AC_OVERLAY_LEARN_CANCELLED:
+            return PSTR("Not learned ");
+        default:
+            return PSTR("            ");
+    }
+}
+
+static const char *layer_name_P(uint8_t layer) {
+    // Names are padded to the same width so a shorter name overwrites a longer one.
+    switch (layer) {
         case _QWERTZ:
-            oled_write_P(PSTR("Default\n"), false);
-            break;
+            return PSTR("Default   ");
         case _NAV:
-            oled_write_P(PSTR("Navigation\n"), false);
-            break;
+            return PSTR("Navigation");
         case _SYM:
-            oled_write_P(PSTR("Symbols\n"), false);
-            break;
+            return PSTR("Symbols   ");
         case _BRACS:
-            oled_write_P(PSTR("Bracets\n"), false);
-            break;
+            return PSTR("Bracets   ");
         case _FUNCTION:
-            oled_write_P(PSTR("Function\n"), false);
-            break;
+            return PSTR("Function  ");
         case _GAMING:
-            oled_write_P(PSTR("Gaming\n"), false);
-            break;
+            return PSTR("Gaming    ");
         case _MOUSE:
-        	oled_write_P(PSTR("Mouse\n"), false);
-        	break;
+            return PSTR("Mouse     ");
         default:
-            oled_write_P(PSTR("Undefined\n"), false);
+            return PSTR("Undefined ");
     }
+}
 
-    uint8_t cosm = get_oneshot_mods();
-    oled_write_P(PSTR("Oneshot: "), false);
-    oled_write_P((cosm & MOD_MASK_SHIFT) ? PSTR("SHIFT ") : PSTR("      "), false);
-    oled_write_P((cosm & MOD_MASK_CTRL) ? PSTR("CTRL \n") : PSTR("     \n"), false);
+void render_status(void) {
+    const status_state_t *state = &status_now;
+
+    bool force = !status_shown.drawn;
+    if (force) {
+        // Static labels are written once; the fields below are forced to redraw.
+        oled_clear();
+        oled_write_field_P(0, 0, PSTR("Layer: "));
+        oled_write_field_P(0, 1, PSTR("Oneshot: "));
+        oled_write_field_P(0, 6, PSTR("WPM: "));
+#ifdef DEBUG_MATRIX_SCAN_RATE
+        oled_write_field_P(0, 7, PSTR("Scan: "));
+#endif
+        memset(status_shown.wpm_digits, 0xFF, sizeof(status_shown.wpm_digits));
+#ifdef DEBUG_MATRIX_SCAN_RATE
+        memset(status_shown.scan_digits, 0xFF, sizeof(status_shown.scan_digits));
+#endif
+        status_shown.drawn = true;
+    }
 
-    oled_write_P(is_caps_word_on() ? PSTR("Caps Wrd ") : PSTR("         "), false);
-    oled_write_P(leader_sequence_active() ? PSTR("Leader \n\n") : PSTR("       \n\n"), false);
+    // Host Keyboard Layer Status
+    if (force || state->layer != status_shown.layer) {
+        status_shown.layer = state->layer;
+        oled_write_field_P(7, 0, layer_name_P(state->layer));
+    }
+
+    uint8_t cosm = state->oneshot_mods;
+    if (force || cosm != status_shown.oneshot_mods) {
+        status_shown.oneshot_mods = cosm;
+        oled_write_field_P(9, 1, (cosm & MOD_MASK_SHIFT) ? PSTR("SHIFT ") : PSTR("      "));
+        oled_write_field_P(15, 1, (cosm & MOD_MASK_CTRL) ? PSTR("CTRL ") : PSTR("     "));
+    }
+
+    bool caps_word = state->flags & STATUS_CAPS_WORD;
+    if (force || caps_word != status_shown.caps_word) {
+        status_shown.caps_word = caps_word;
+        oled_write_field_P(0, 2, caps_word ? PSTR("Caps Wrd ") : PSTR("         "));
+    }
+
+    bool leader = state->flags & STATUS_LEADER;
+    if (force || leader != status_shown.leader) {
+        status_shown.leader = leader;
+        oled_write_field_P(9, 2, leader ? PSTR("Leader ") : PSTR("       "));
+    }
+
+    bool autocorrect = state->flags & STATUS_AUTOCORRECT;
+    if (force || autocorrect != status_shown.autocorrect) {
+        status_shown.autocorrect = autocorrect;
+        oled_write_field_P(0, 4, autocorrect ? PSTR("Autocorrect") : PSTR("           "));
+    }
 
-    oled_write_P(autocorrect_is_enabled() ? PSTR("Autocorrect\n") : PSTR("           \n"), false);
+    // Learn mode of the autocorrect overlay and how it ended.
+    if (force || state->learn != status_shown.learn) {
+        status_shown.learn = state->learn;
+        oled_write_field_P(0, 3, learn_state_P(state->learn));
+    }
 
     // Write host Keyboard LED Status to OLEDs
-    led_t led_usb_state = host_keyboard_led_state();
-    oled_write_P(led_usb_state.num_lock    ? PSTR("NUMLCK ") : PSTR("       "), false);
-    oled_write_P(led_usb_state.caps_lock   ? PSTR("CAPLCK ") : PSTR("       "), false);
-    oled_write_P(led_usb_state.scroll_lock ? PSTR("SCRLCK \n") : PSTR("       \n"), false);
+    led_t led_usb_state = {.raw = state->leds};
+    if (force || led_usb_state.raw != status_shown.leds.raw) {
+        status_shown.leds = led_usb_state;
+        oled_write_field_P(0, 5, led_usb_state.num_lock ? PSTR("NUMLCK ") : PSTR("       "));
+        oled_write_field_P(7, 5, led_usb_state.caps_lock ? PSTR("CAPLCK ") : PSTR("       "));
+        oled_write_field_P(14, 5, led_usb_state.scroll_lock ? PSTR("SCRLCK ") : PSTR("       "));
+    }
+
+    oled_write_digits(5, 6, status_shown.wpm_digits, sizeof(status_shown.wpm_digits), state->wpm);
+#ifdef DEBUG_MATRIX_SCAN_RATE
+    // Matrix scans per second, to compare the main loop rate before and after OLED changes.
+    oled_write_digits(6, 7, status_shown.scan_digits, sizeof(status_shown.scan_digits), state->scan_rate);
+#endif
+}
 
-    static char wpm_str[4];
+// Status on the slave from the state the master sends through status_sync.c,
+// same per-field updates as render_status(). The logo leaves the right half
+// of its top three rows blank, from column MIRROR_COL on; the mirror stays
+// inside it so both are drawn once and never over each other.
+#define MIRROR_COL 11
+static status_snapshot_t mirror_shown;
 
-    sprintf(wpm_str, "%03d", get_current_wpm());
-    oled_write_P(PSTR("WPM: "), false);
-    oled_write(wpm_str, false);
+static void render_mirror_invalidate(void) {
+    mirror_shown.drawn = false;
+}
+
+static void render_mirror(void) {
+    const status_state_t *state = status_sync_received();
+
+    bool force = !mirror_shown.drawn;
+    if (force) {
+        memset(mirror_shown.wpm_digits, 0xFF, sizeof(mirror_shown.wpm_digits));
+        mirror_shown.drawn = true;
+    }
+    if (force || state->layer != mirror_shown.layer) {
+        mirror_shown.layer = state->layer;
+        oled_write_field_P(MIRROR_COL, 0, layer_name_P(state->layer));
+        OLED_COUNT_BYTES(10 * OLED_FONT_WIDTH);
+    }
+    if (force || state->oneshot_mods != mirror_shown.oneshot_mods) {
+        mirror_shown.oneshot_mods = state->oneshot_mods;
+        oled_write_field_P(MIRROR_COL, 1, (state->oneshot_mods & MOD_MASK_SHIFT) ? PSTR("S") : PSTR(" "));
+        oled_write_field_P(MIRROR_COL + 1, 1, (state->oneshot_mods & MOD_MASK_CTRL) ? PSTR("C") : PSTR(" "));
+        OLED_COUNT_BYTES(2 * OLED_FONT_WIDTH);
+    }
+    bool caps_word = state->flags & STATUS_CAPS_WORD;
+    if (force || caps_word != mirror_shown.caps_word) {
+        mirror_shown.caps_word = caps_word;
+        oled_write_field_P(MIRROR_COL + 3, 1, caps_word ? PSTR("CW") : PSTR("  "));
+        OLED_COUNT_BYTES(2 * OLED_FONT_WIDTH);
+    }
+    oled_write_digits(MIRROR_COL + 7, 1, mirror_shown.wpm_digits, sizeof(mirror_shown.wpm_digits), state->wpm);
+}
+
+// The logo never changes, so it is decoded into the OLED buffer once after boot
+// or wake and left alone until render_logo_invalidate() is called. Decoding is
+// spread over a few frames, BITMAP_RLE_BUDGET bytes at a time.
+static bool         logo_drawn    = false;
+static bool         logo_decoding = false;
+static rle_stream_t logo_stream;
+
+void render_logo_invalidate(void) {
+    logo_drawn    = false;
+    logo_decoding = false;
 }
 
 void render_logo(void) {
-    // clang-format off
-    static const char PROGMEM kyria_logo[] = {
-        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,128,192,224,240,112,120, 56, 60, 28, 30, 14, 14, 14,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 14, 14, 14, 30, 28, 60, 56,120,112,240,224,192,128,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-        0,  0,  0,  0,  0,  0,  0,192,224,240,124, 62, 31, 15,  7,  3,  1,128,192,224,240,120, 56, 60, 28, 30, 14, 14,  7,  7,135,231,127, 31,255,255, 31,127,231,135,  7,  7, 14, 14, 30, 28, 60, 56,120,240,224,192,128,  1,  3,  7, 15, 31, 62,124,240,224,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-        0,  0,  0,  0,240,252,255, 31,  7,  1,  0,  0,192,240,252,254,255,247,243,177,176, 48, 48, 48, 48, 48, 48, 48,120,254,135,  1,  0,  0,255,255,  0,  0,  1,135,254,120, 48, 48, 48, 48, 48, 48, 48,176,177,243,247,255,254,252,240,192,  0,  0,  1,  7, 31,255,252,240,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-        0,  0,  0,255,255,255,  0,  0,  0,  0,  0,254,255,255,  1,  1,  7, 30,120,225,129,131,131,134,134,140,140,152,152,177,183,254,248,224,255,255,224,248,254,183,177,152,152,140,140,134,134,131,131,129,225,120, 30,  7,  1,  1,255,255,254,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0,255,255,  0,  0,192,192, 48, 48,  0,  0,240,240,  0,  0,  0,  0,  0,  0,240,240,  0,  0,240,240,192,192, 48, 48, 48, 48,192,192,  0,  0, 48, 48,243,243,  0,  0,  0,  0,  0,  0, 48, 48, 48, 48, 48, 48,192,192,  0,  0,  0,  0,  0,
-        0,  0,  0,255,255,255,  0,  0,  0,  0,  0,127,255,255,128,128,224,120, 30,135,129,193,193, 97, 97, 49, 49, 25, 25,141,237,127, 31,  7,255,255,  7, 31,127,237,141, 25, 25, 49, 49, 97, 97,193,193,129,135, 30,120,224,128,128,255,255,127,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0, 63, 63,  3,  3, 12, 12, 48, 48,  0,  0,  0,  0, 51, 51, 51, 51, 51, 51, 15, 15,  0,  0, 63, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48, 48, 63, 63, 48, 48,  0,  0, 12, 12, 51, 51, 51, 51, 51, 51, 63, 63,  0,  0,  0,  0,  0,
-        0,  0,  0,  0, 15, 63,255,248,224,128,  0,  0,  3, 15, 63,127,255,239,207,141, 13, 12, 12, 12, 12, 12, 12, 12, 30,127,225,128,  0,  0,255,255,  0,  0,128,225,127, 30, 12, 12, 12, 12, 12, 12, 12, 13,141,207,239,255,127, 63, 15,  3,  0,  0,128,224,248,255, 63, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-        0,  0,  0,  0,  0,  0,  0,  3,  7, 15, 62,124,248,240,224,192,128,  1,  3,  7, 15, 30, 28, 60, 56,120,112,112,224,224,225,231,254,248,255,255,248,254,231,225,224,224,112,112,120, 56, 60, 28, 30, 15,  7,  3,  1,128,192,224,240,248,124, 62, 15,  7,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  3,  7, 15, 14, 30, 28, 60, 56,120,112,112,112,224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,112,112,112,120, 56, 60, 28, 30, 14, 15,  7,  3,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
-    };
-    // clang-format on
-    oled_write_raw_P(kyria_logo, sizeof(kyria_logo));
+    if (logo_drawn) {
+        return;
+    }
+    if (!logo_decoding) {
+        rle_stream_init(&logo_stream, kyria_logo, sizeof(kyria_logo), 0);
+        logo_decoding = true;
+    }
+
+    uint16_t out = logo_stream.out;
+    logo_drawn   = rle_stream_step(&logo_stream, BITMAP_RLE_BUDGET);
+    OLED_COUNT_BYTES(logo_stream.out - out);
+    if (logo_drawn) {
+        logo_decoding = false;
+        // The logo's blank areas clear the mirror and the counter, so they
+        // are written again.
+        render_mirror_invalidate();
+#ifdef OLED_BYTES_MONITOR
+        memset(oled_bytes_digits, 0xFF, sizeof(oled_bytes_digits));
+#endif
+    }
+}
+
+#ifdef OLED_BYTES_MONITOR
+static void render_bytes_rate(void) {
+    if (timer_elapsed(oled_bytes_timer) >= 1000) {
+        oled_bytes_timer   = timer_read();
+        oled_bytes_rate    = oled_bytes_written;
+        oled_bytes_written = 0;
+    }
+    // In the blank right half of the logo's bottom row.
+    oled_write_digits(MIRROR_COL + 5, 7, oled_bytes_digits, sizeof(oled_bytes_digits), oled_bytes_rate);
 }
+#endif
 
 // void render_boot(bool bootloader) {
 //     if (is_keyboard_master()) {
@@ -394,7 +784,36 @@ void render_logo(void) {
 //     }
 // }
 
+#ifdef OLED_DEFER_TO_IDLE
+#    ifndef OLED_DEFER_IDLE_MS
+#        define OLED_DEFER_IDLE_MS 100
+#    endif
+#    ifndef OLED_DEFER_MAX_MS
+#        define OLED_DEFER_MAX_MS 1000
+#    endif
+static uint16_t oled_composed;
+
+// While keys are coming in, the status is only composed every OLED_DEFER_MAX_MS.
+// No new dirty blocks means no I2C traffic in the main loop between keys.
+static bool oled_deferred(void) {
+    if (last_input_activity_elapsed() < OLED_DEFER_IDLE_MS && timer_elapsed(oled_composed) < OLED_DEFER_MAX_MS) {
+        return true;
+    }
+    oled_composed = timer_read();
+    return false;
+}
+#endif
+
 bool oled_task_user(void) {
+    if (!idle_governor_render_due()) {
+        return false;
+    }
+#ifdef OLED_DEFER_TO_IDLE
+    if (is_keyboard_master() && oled_deferred()) {
+        return false;
+    }
+#endif
+    PROFILE_BEGIN(PROFILE_OLED);
     if (is_keyboard_master()) {
         // QMK Logo and version information
         // clang-format off
@@ -408,14 +827,37 @@ bool oled_task_user(void) {
 
         oled_write_P(PSTR("Kyria rev3.1\n\n"), false);*/
 
-       render_status();
+#ifdef PROFILE_ENABLE
+        if (profile_oled_page_active()) {
+            status_shown.drawn = false;  // Full redraw once the page is closed.
+            profile_render_oled();
+        } else
+#endif
+            render_status();
 
     } else {
         render_logo();
+        if (logo_drawn) {
+            render_mirror();
+        }
+#ifdef OLED_BYTES_MONITOR
+        render_bytes_rate();
+#endif
     }
+    PROFILE_END(PROFILE_OLED);
     return false;
 }
 
+// The host may cut power next, whatever is still waiting for idle is written now.
+void suspend_power_down_user(void) {
+    dyn_macro_save();
+    typing_stats_save();
+}
+
+void suspend_wakeup_init_user(void) {
+    render_logo_invalidate();
+}
+
 // bool shutdown_user(bool jump_to_bootloader) {
 //     render_boot(jump_to_bootloader);
 //     return true;
@@ -0,0 +1,40 @@
+// Generated by tools/bitmap_rle.py, do not edit.
+// 128x64 pixels, 1024 bytes raw, 492 bytes compressed.
+
+#pragma once
+
+// clang-format off
+static const uint8_t PROGMEM kyria_logo[] = {
+    0x8C, 0x00, 0x81, 0x80, 0x08, 0xC0, 0xE0, 0xF0, 0x70, 0x78, 0x38, 0x3C, 0x1C, 0x1E, 0x82, 0x0E,
+    0x8F, 0x07, 0x82, 0x0E, 0x0A, 0x1E, 0x1C, 0x3C, 0x38, 0x78, 0x70, 0xF0, 0xE0, 0xC0, 0x80, 0x80,
+    0xCD, 0x00, 0x37, 0xC0, 0xE0, 0xF0, 0x7C, 0x3E, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x80, 0xC0, 0xE0,
+    0xF0, 0x78, 0x38, 0x3C, 0x1C, 0x1E, 0x0E, 0x0E, 0x07, 0x07, 0x87, 0xE7, 0x7F, 0x1F, 0xFF, 0xFF,
+    0x1F, 0x7F, 0xE7, 0x87, 0x07, 0x07, 0x0E, 0x0E, 0x1E, 0x1C, 0x3C, 0x38, 0x78, 0xF0, 0xE0, 0xC0,
+    0x80, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3E, 0x7C, 0xF0, 0xE0, 0xC0, 0xC4, 0x00, 0x10, 0xF0, 0xFC,
+    0xFF, 0x1F, 0x07, 0x01, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFE, 0xFF, 0xF7, 0xF3, 0xB1, 0xB0, 0x86,
+    0x30, 0x0D, 0x78, 0xFE, 0x87, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x87, 0xFE, 0x78,
+    0x86, 0x30, 0x10, 0xB0, 0xB1, 0xF3, 0xF7, 0xFF, 0xFE, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x01, 0x07,
+    0x1F, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x82, 0xFF, 0x84, 0x00, 0x2F, 0xFE, 0xFF, 0xFF, 0x01, 0x01,
+    0x07, 0x1E, 0x78, 0xE1, 0x81, 0x83, 0x83, 0x86, 0x86, 0x8C, 0x8C, 0x98, 0x98, 0xB1, 0xB7, 0xFE,
+    0xF8, 0xE0, 0xFF, 0xFF, 0xE0, 0xF8, 0xFE, 0xB7, 0xB1, 0x98, 0x98, 0x8C, 0x8C, 0x86, 0x86, 0x83,
+    0x83, 0x81, 0xE1, 0x78, 0x1E, 0x07, 0x01, 0x01, 0xFF, 0xFF, 0xFE, 0x84, 0x00, 0x82, 0xFF, 0x83,
+    0x00, 0x81, 0xFF, 0x81, 0x00, 0x81, 0xC0, 0x81, 0x30, 0x81, 0x00, 0x81, 0xF0, 0x85, 0x00, 0x81,
+    0xF0, 0x81, 0x00, 0x81, 0xF0, 0x81, 0xC0, 0x83, 0x30, 0x81, 0xC0, 0x81, 0x00, 0x81, 0x30, 0x81,
+    0xF3, 0x85, 0x00, 0x85, 0x30, 0x81, 0xC0, 0x87, 0x00, 0x82, 0xFF, 0x84, 0x00, 0x2F, 0x7F, 0xFF,
+    0xFF, 0x80, 0x80, 0xE0, 0x78, 0x1E, 0x87, 0x81, 0xC1, 0xC1, 0x61, 0x61, 0x31, 0x31, 0x19, 0x19,
+    0x8D, 0xED, 0x7F, 0x1F, 0x07, 0xFF, 0xFF, 0x07, 0x1F, 0x7F, 0xED, 0x8D, 0x19, 0x19, 0x31, 0x31,
+    0x61, 0x61, 0xC1, 0xC1, 0x81, 0x87, 0x1E, 0x78, 0xE0, 0x80, 0x80, 0xFF, 0xFF, 0x7F, 0x84, 0x00,
+    0x82, 0xFF, 0x83, 0x00, 0x81, 0x3F, 0x81, 0x03, 0x81, 0x0C, 0x81, 0x30, 0x83, 0x00, 0x85, 0x33,
+    0x81, 0x0F, 0x81, 0x00, 0x81, 0x3F, 0x89, 0x00, 0x81, 0x30, 0x81, 0x3F, 0x81, 0x30, 0x81, 0x00,
+    0x81, 0x0C, 0x85, 0x33, 0x81, 0x3F, 0x88, 0x00, 0x10, 0x0F, 0x3F, 0xFF, 0xF8, 0xE0, 0x80, 0x00,
+    0x00, 0x03, 0x0F, 0x3F, 0x7F, 0xFF, 0xEF, 0xCF, 0x8D, 0x0D, 0x86, 0x0C, 0x0D, 0x1E, 0x7F, 0xE1,
+    0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0xE1, 0x7F, 0x1E, 0x86, 0x0C, 0x10, 0x0D, 0x8D,
+    0xCF, 0xEF, 0xFF, 0x7F, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0xFF, 0x3F, 0x0F, 0xC4,
+    0x00, 0x37, 0x03, 0x07, 0x0F, 0x3E, 0x7C, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x01, 0x03, 0x07, 0x0F,
+    0x1E, 0x1C, 0x3C, 0x38, 0x78, 0x70, 0x70, 0xE0, 0xE0, 0xE1, 0xE7, 0xFE, 0xF8, 0xFF, 0xFF, 0xF8,
+    0xFE, 0xE7, 0xE1, 0xE0, 0xE0, 0x70, 0x70, 0x78, 0x38, 0x3C, 0x1C, 0x1E, 0x0F, 0x07, 0x03, 0x01,
+    0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0x7C, 0x3E, 0x0F, 0x07, 0x03, 0xCD, 0x00, 0x81, 0x01, 0x08, 0x03,
+    0x07, 0x0F, 0x0E, 0x1E, 0x1C, 0x3C, 0x38, 0x78, 0x82, 0x70, 0x8F, 0xE0, 0x82, 0x70, 0x0A, 0x78,
+    0x38, 0x3C, 0x1C, 0x1E, 0x0E, 0x0F, 0x07, 0x03, 0x01, 0x01, 0xC6, 0x00,
+};
+// clang-format on
@@ -0,0 +1,73 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "keymap_introspection.h"
+#include "fast_combo.h"
+#include "layer_cache.h"
+
+// Bit n is set when layer n has something other than KC_TRNS at the key. The
+// highest such bit among the active layers is the layer the key resolves to,
+// so transparent cells never need to be read from keymaps[].
+static layer_state_t occupied[MATRIX_ROWS][MATRIX_COLS];
+
+// Resolved layer and keycode per key, valid while its generation matches.
+static uint8_t  resolved_layer[MATRIX_ROWS][MATRIX_COLS];
+static uint16_t resolved_keycode[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t  resolved_generation[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t  generation;
+
+void layer_cache_init(void) {
+    uint8_t layers = MIN(keymap_layer_count(), MAX_LAYER);
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            occupied[row][col] = 0;
+            for (uint8_t layer = 0; layer < layers; layer++) {
+                if (keycode_at_keymap_location(layer, row, col) != KC_TRNS) {
+                    occupied[row][col] |= (layer_state_t)1 << layer;
+                }
+            }
+        }
+    }
+    memset(resolved_generation, 0, sizeof(resolved_generation));
+    generation = 1;
+}
+
+// Stale entries are recomputed on their next lookup, so invalidating is O(1)
+// no matter how often layers change while typing.
+void layer_cache_invalidate(void) {
+    if (!generation) return; // not initialised yet
+    if (++generation == 0) {
+        memset(resolved_generation, 0, sizeof(resolved_generation));
+        generation = 1;
+    }
+}
+
+// A key that is transparent on every active layer resolves to layer 0, as
+// layer_switch_get_layer() falls back to it, e.g. with a default layer on top
+// of the base that leaves keys transparent.
+static void resolve(uint8_t row, uint8_t col) {
+    layer_state_t layers = occupied[row][col] & (layer_state | default_layer_state);
+
+    resolved_layer[row][col]      = get_highest_layer(layers);
+    resolved_keycode[row][col]    = keycode_at_keymap_location(resolved_layer[row][col], row, col);
+    resolved_generation[row][col] = generation;
+}
+
+// QMK's layer_switch_get_layer() asks for every active layer from the top
+// until it finds a non-transparent keycode. Unoccupied cells answer KC_TRNS
+// and the resolved layer answers from RAM, so the walk reads keymaps[] at most
+// once per layer change. Other requests, e.g. a release on the layer the key
+// was pressed on, still read it. Fired combos are virtual keys on
+// FAST_COMBO_ROW that resolve to the same keycode on every layer.
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
+    if (key.row == FAST_COMBO_ROW) return fast_combo_keycode(key.col);
+    if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) return KC_NO;
+    if (!generation) return keycode_at_keymap_location(layer, key.row, key.col);
+    if (layer >= MAX_LAYER || !(occupied[key.row][key.col] & ((layer_state_t)1 << layer))) return KC_TRNS;
+
+    if (resolved_generation[key.row][key.col] != generation) resolve(key.row, key.col);
+    if (layer == resolved_layer[key.row][key.col]) return resolved_keycode[key.row][key.col];
+    return keycode_at_keymap_location(layer, key.row, key.col);
+}
@@ -0,0 +1,13 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+// Builds the per-key layer occupancy from keymaps[], call once from
+// keyboard_post_init_user(). Until then lookups read keymaps[] directly.
+void layer_cache_init(void);
+
+// Call from layer_state_set_user() and default_layer_state_set_user().
+void layer_cache_invalidate(void);
@@ -0,0 +1,118 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "leader_table.h"
+#include "send_string_fast.h"
+#include "unicode_fast.h"
+#include "dyn_macro.h"
+
+#define LEADER_NONE 0xFF
+
+// Trie over the leader sequences, stored as first-child/next-sibling links.
+// Node 0 is the root. Resolving a sequence costs one sibling scan per key, so
+// it depends on the sequence length and not on how many sequences exist.
+typedef struct {
+    uint16_t key;
+    uint8_t  child;
+    uint8_t  sibling;
+    uint8_t  sequence;
+} leader_node_t;
+
+static leader_node_t nodes[LEADER_TABLE_NODES];
+static uint8_t       node_count;
+static uint8_t       current = LEADER_NONE;
+static uint8_t       depth;
+
+static uint8_t find_child(uint8_t node, uint16_t key) {
+    for (uint8_t i = nodes[node].child; i != LEADER_NONE; i = nodes[i].sibling) {
+        if (nodes[i].key == key) {
+            return i;
+        }
+    }
+    return LEADER_NONE;
+}
+
+void leader_table_init(void) {
+    nodes[0]   = (leader_node_t){.child = LEADER_NONE, .sibling = LEADER_NONE, .sequence = LEADER_NONE};
+    node_count = 1;
+
+    for (uint8_t s = 0; s < leader_sequences_count; s++) {
+        uint8_t node = 0;
+        for (uint8_t k = 0; k < LEADER_TABLE_MAX_KEYS && leader_sequences[s].keys[k] != KC_NO; k++) {
+            uint16_t key   = leader_sequences[s].keys[k];
+            uint8_t  child = find_child(node, key);
+            if (child == LEADER_NONE) {
+                if (node_count >= LEADER_TABLE_NODES) {
+                    dprintf("leader: trie full, raise LEADER_TABLE_NODES\n");
+                    return;
+                }
+                child             = node_count++;
+                nodes[child]      = (leader_node_t){.key = key, .child = LEADER_NONE, .sibling = nodes[node].child, .sequence = LEADER_NONE};
+                nodes[node].child = child;
+            }
+            node = child;
+        }
+        if (node != 0 && nodes[node].sequence == LEADER_NONE) {
+            nodes[node].sequence = s;
+        }
+    }
+}
+
+void leader_table_start(void) {
+    current = 0;
+    depth   = 0;
+}
+
+void leader_table_record(uint16_t keycode, keyrecord_t *record) {
+    // Mirror the checks process_leader() does before it adds a key, which runs after us.
+    if (!record->event.pressed || !leader_sequence_active() || leader_sequence_timed_out() || current == LEADER_NONE) {
+        return;
+    }
+#ifndef LEADER_KEY_STRICT_KEY_PROCESSING
+    if (IS_QK_MOD_TAP(keycode)) {
+        keycode = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+    } else if (IS_QK_LAYER_TAP(keycode)) {
+        keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+    }
+#endif
+    // A key beyond the buffer is not added, process_leader() ends the sequence
+    // and QMK resolves the five keys it holds, so stay on their node.
+    if (depth >= LEADER_TABLE_MAX_KEYS) {
+        return;
+    }
+    current = find_child(current, keycode);
+    depth++;
+}
+
+void leader_table_end(void) {
+    uint8_t node = current;
+    current      = LEADER_NONE;
+    if (node == LEADER_NONE || nodes[node].sequence == LEADER_NONE) {
+        return;
+    }
+
+    const leader_sequence_t *sequence = &leader_sequences[nodes[node].sequence];
+    switch (sequence->action) {
+        case LEADER_ACTION_STRING:
+            send_string_fast(sequence->string);
+            break;
+        case LEADER_ACTION_KEYCODE:
+            tap_code16(sequence->keycode);
+            break;
+#ifdef UNICODEMAP_ENABLE
+        case LEADER_ACTION_UNICODE:
+            unicode_fast_send_map(sequence->unicode_index);
+            break;
+#endif
+        case LEADER_ACTION_UNICODE_STRING:
+            unicode_fast_send_string(sequence->string);
+            break;
+        case LEADER_ACTION_DYNAMIC_MACRO:
+            dyn_macro_command(sequence->keycode);
+            break;
+        case LEADER_ACTION_FUNCTION:
+            sequence->function();
+            break;
+    }
+}
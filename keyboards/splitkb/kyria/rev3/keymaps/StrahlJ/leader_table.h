@@ -0,0 +1,59 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+// QMK's leader buffer holds five keys, longer sequences can never match. A
+// sixth key ends the sequence with the five it has and is then typed as usual.
+#define LEADER_TABLE_MAX_KEYS 5
+
+// Number of trie nodes, at most one per key over all sequences plus the root.
+#ifndef LEADER_TABLE_NODES
+#    define LEADER_TABLE_NODES 96
+#endif
+
+typedef enum {
+    LEADER_ACTION_STRING,
+    LEADER_ACTION_KEYCODE,
+    LEADER_ACTION_UNICODE,
+    LEADER_ACTION_UNICODE_STRING,
+    LEADER_ACTION_DYNAMIC_MACRO,
+    LEADER_ACTION_FUNCTION,
+} leader_action_t;
+
+typedef struct {
+    uint16_t keys[LEADER_TABLE_MAX_KEYS];
+    uint8_t  action;
+    union {
+        const char *string;
+        uint16_t    keycode;
+        uint16_t    unicode_index;
+        void (*function)(void);
+    };
+} leader_sequence_t;
+
+// Helpers for declaring leader_sequences[], e.g.
+//   {LEADER_KEYS(KC_L, KC_K), LEADER_STRING("loadkeys de-latin1")},
+#define LEADER_KEYS(...) .keys = {__VA_ARGS__}
+#define LEADER_STRING(str) .action = LEADER_ACTION_STRING, .string = (str)
+#define LEADER_TAP(kc) .action = LEADER_ACTION_KEYCODE, .keycode = (kc)
+#define LEADER_UNICODE(index) .action = LEADER_ACTION_UNICODE, .unicode_index = (index)
+#define LEADER_UNICODE_STRING(str) .action = LEADER_ACTION_UNICODE_STRING, .string = (str)
+#define LEADER_DYNAMIC_MACRO(kc) .action = LEADER_ACTION_DYNAMIC_MACRO, .keycode = (kc)
+#define LEADER_CALL(fn) .action = LEADER_ACTION_FUNCTION, .function = (fn)
+
+// Defined by the keymap.
+extern const leader_sequence_t leader_sequences[];
+extern const uint8_t           leader_sequences_count;
+
+// Builds the trie from leader_sequences[], call once from keyboard_post_init_user().
+void leader_table_init(void);
+
+// Called from leader_start_user() and leader_end_user().
+void leader_table_start(void);
+void leader_table_end(void);
+
+// Called from process_record_user() to follow the trie as keys are added to the sequence.
+void leader_table_record(uint16_t keycode, keyrecord_t *record);
@@ -0,0 +1,189 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "mouse_engine.h"
+
+#define MOUSE_UP 0x01
+#define MOUSE_DOWN 0x02
+#define MOUSE_LEFT 0x04
+#define MOUSE_RIGHT 0x08
+#define MOUSE_WHEEL_UP 0x10
+#define MOUSE_WHEEL_DOWN 0x20
+#define MOUSE_WHEEL_LEFT 0x40
+#define MOUSE_WHEEL_RIGHT 0x80
+#define MOUSE_CURSOR 0x0F
+#define MOUSE_WHEEL 0xF0
+
+// Longest interval credited in one report, so a stalled loop doesn't jump the cursor.
+#define MOUSE_MAX_STEP 32
+
+static uint8_t  held; // MOUSE_*
+static uint8_t  buttons;
+static uint8_t  sent_buttons;
+static uint8_t  speed_keys; // MS_ACL0..MS_ACL2 held, a bit each
+static uint16_t move_start;
+static uint16_t last_update;
+
+// Motion not reported yet, in 1/256 pixel or wheel step.
+static int32_t acc_x, acc_y, acc_v, acc_h;
+
+static uint16_t cursor_speed(void) {
+    // As in QMK's momentary acceleration, the slowest held speed key wins.
+    if ((speed_keys & 1) || (get_mods() & MOUSE_PRECISION_MODS)) return MOUSE_PRECISION_SPEED;
+    if (speed_keys & 2) return MOUSE_SPEED_MID;
+    if (speed_keys & 4) return MOUSE_SPEED_MAX;
+
+    uint16_t held_ms = timer_elapsed(move_start);
+    if (held_ms >= MOUSE_ACCEL_TIME) return MOUSE_SPEED_MAX;
+
+    uint32_t ramp = ((uint32_t)held_ms << 8) / MOUSE_ACCEL_TIME; // 0..255
+#if MOUSE_CURVE == MOUSE_CURVE_QUADRATIC
+    ramp = (ramp * ramp) >> 8;
+#endif
+    return MOUSE_SPEED_MIN + (((uint32_t)(MOUSE_SPEED_MAX - MOUSE_SPEED_MIN) * ramp) >> 8);
+}
+
+// Units per second times ms, in 1/256 units. 131 / 512 is 256 / 1000 within 0.1%
+// and saves a division on the Cortex-M0+.
+static int32_t distance(uint16_t per_second, uint16_t ms) {
+    return ((uint32_t)per_second * ms * 131) >> 9;
+}
+
+static void advance(uint16_t ms) {
+    if (held & MOUSE_CURSOR) {
+        int32_t step = distance(cursor_speed(), ms);
+        // Diagonals move at the same speed as straight lines, 181 / 256 is 1 / sqrt(2).
+        if ((held & (MOUSE_UP | MOUSE_DOWN)) && (held & (MOUSE_LEFT | MOUSE_RIGHT))) step = (step * 181) >> 8;
+        if (held & MOUSE_UP) acc_y -= step;
+        if (held & MOUSE_DOWN) acc_y += step;
+        if (held & MOUSE_LEFT) acc_x -= step;
+        if (held & MOUSE_RIGHT) acc_x += step;
+    }
+    if (held & MOUSE_WHEEL) {
+        int32_t step = distance(MOUSE_WHEEL_SPEED, ms);
+        if (held & MOUSE_WHEEL_UP) acc_v += step;
+        if (held & MOUSE_WHEEL_DOWN) acc_v -= step;
+        if (held & MOUSE_WHEEL_LEFT) acc_h -= step;
+        if (held & MOUSE_WHEEL_RIGHT) acc_h += step;
+    }
+}
+
+// Takes the whole units out of an accumulator, the fraction stays for the next report.
+static int8_t take(int32_t *acc) {
+    int32_t whole = *acc / 256;
+
+    if (whole > 127) whole = 127;
+    if (whole < -127) whole = -127;
+    *acc -= whole * 256;
+    return whole;
+}
+
+static void send_report(void) {
+    report_mouse_t report = {.buttons = buttons};
+
+    report.x = take(&acc_x);
+    report.y = take(&acc_y);
+    report.v = take(&acc_v);
+    report.h = take(&acc_h);
+    if (!report.x && !report.y && !report.v && !report.h && buttons == sent_buttons) return;
+    sent_buttons = buttons;
+    host_mouse_send(&report);
+}
+
+static uint8_t direction(uint16_t keycode) {
+    switch (keycode) {
+        case MS_UP:
+            return MOUSE_UP;
+        case MS_DOWN:
+            return MOUSE_DOWN;
+        case MS_LEFT:
+            return MOUSE_LEFT;
+        case MS_RGHT:
+            return MOUSE_RIGHT;
+        case MS_WHLU:
+            return MOUSE_WHEEL_UP;
+        case MS_WHLD:
+            return MOUSE_WHEEL_DOWN;
+        case MS_WHLL:
+            return MOUSE_WHEEL_LEFT;
+        case MS_WHLR:
+            return MOUSE_WHEEL_RIGHT;
+        default:
+            return 0;
+    }
+}
+
+bool process_mouse_engine(uint16_t keycode, keyrecord_t *record) {
+    bool pressed = record->event.pressed;
+
+    switch (keycode) {
+        case MS_BTN1 ... MS_BTN8: {
+            uint8_t button = 1 << (keycode - MS_BTN1);
+            buttons        = pressed ? buttons | button : buttons & ~button;
+            send_report();
+            return false;
+        }
+        case MS_ACL0 ... MS_ACL2: {
+            uint8_t key = 1 << (keycode - MS_ACL0);
+            speed_keys  = pressed ? speed_keys | key : speed_keys & ~key;
+            return false;
+        }
+    }
+
+    uint8_t bit = direction(keycode);
+    if (!bit) return true;
+
+    if (!pressed) {
+        held &= ~bit;
+        // The next movement starts from a whole pixel and from the bottom of the curve.
+        if (!(held & MOUSE_CURSOR)) acc_x = acc_y = 0;
+        if (!(held & MOUSE_WHEEL)) acc_v = acc_h = 0;
+        return false;
+    }
+
+    if (!held) last_update = timer_read();
+    if ((bit & MOUSE_CURSOR) && !(held & MOUSE_CURSOR)) move_start = timer_read();
+    held |= bit;
+
+    // A tap moves one pixel or scrolls one step right away.
+    switch (bit) {
+        case MOUSE_UP:
+            acc_y -= 256;
+            break;
+        case MOUSE_DOWN:
+            acc_y += 256;
+            break;
+        case MOUSE_LEFT:
+            acc_x -= 256;
+            break;
+        case MOUSE_RIGHT:
+            acc_x += 256;
+            break;
+        case MOUSE_WHEEL_UP:
+            acc_v += 256;
+            break;
+        case MOUSE_WHEEL_DOWN:
+            acc_v -= 256;
+            break;
+        case MOUSE_WHEEL_LEFT:
+            acc_h -= 256;
+            break;
+        case MOUSE_WHEEL_RIGHT:
+            acc_h += 256;
+            break;
+    }
+    send_report();
+    return false;
+}
+
+void mouse_engine_task(void) {
+    if (!held) return;
+
+    uint16_t elapsed = timer_elapsed(last_update);
+    if (elapsed < MOUSE_REPORT_INTERVAL) return;
+    last_update += elapsed;
+
+    advance(elapsed > MOUSE_MAX_STEP ? MOUSE_MAX_STEP : elapsed);
+    send_report();
+}
@@ -0,0 +1,55 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+#define MOUSE_CURVE_LINEAR 0
+#define MOUSE_CURVE_QUADRATIC 1
+
+// Cursor speed in pixels per second, from the first report of a movement up
+// to the top speed after MOUSE_ACCEL_TIME ms along MOUSE_CURVE.
+#ifndef MOUSE_SPEED_MIN
+#    define MOUSE_SPEED_MIN 120
+#endif
+#ifndef MOUSE_SPEED_MAX
+#    define MOUSE_SPEED_MAX 1500
+#endif
+#ifndef MOUSE_ACCEL_TIME
+#    define MOUSE_ACCEL_TIME 800
+#endif
+#ifndef MOUSE_CURVE
+#    define MOUSE_CURVE MOUSE_CURVE_QUADRATIC
+#endif
+
+// Constant cursor speeds instead of the curve: MOUSE_PRECISION_SPEED while
+// MS_ACL0 or one of MOUSE_PRECISION_MODS is held, MOUSE_SPEED_MID with MS_ACL1
+// and MOUSE_SPEED_MAX with MS_ACL2. The slowest held key counts.
+#ifndef MOUSE_PRECISION_SPEED
+#    define MOUSE_PRECISION_SPEED 60
+#endif
+#ifndef MOUSE_PRECISION_MODS
+#    define MOUSE_PRECISION_MODS MOD_MASK_SHIFT
+#endif
+#ifndef MOUSE_SPEED_MID
+#    define MOUSE_SPEED_MID 500
+#endif
+
+// Wheel steps per second.
+#ifndef MOUSE_WHEEL_SPEED
+#    define MOUSE_WHEEL_SPEED 12
+#endif
+
+// Minimum ms between two motion reports. Positions are tracked in 1/256
+// pixel, so a shorter interval gives more, smaller steps at the same speed.
+#ifndef MOUSE_REPORT_INTERVAL
+#    define MOUSE_REPORT_INTERVAL 4
+#endif
+
+// Handles the MS_* keycodes in place of QMK's mouse keys. Call from
+// process_record_user(), returns false if the event was consumed.
+bool process_mouse_engine(uint16_t keycode, keyrecord_t *record);
+
+// Sends the motion due since the last report, call from housekeeping_task_user().
+void mouse_engine_task(void);
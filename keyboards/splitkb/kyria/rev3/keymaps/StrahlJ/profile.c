@@ -0,0 +1,179 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "print.h"
+#include "raw_hid_commands.h"
+#include "profile.h"
+
+#ifndef PROFILE_OLED_INTERVAL
+#    define PROFILE_OLED_INTERVAL 500
+#endif
+
+typedef struct {
+    uint32_t count;
+    uint32_t total_us;
+    uint16_t min_us;
+    uint16_t max_us;
+    uint16_t buckets[PROFILE_BUCKETS];
+} profile_stat_t;
+
+static profile_stat_t stats[PROFILE_SLOT_COUNT];
+static uint32_t       started[PROFILE_SLOT_COUNT];
+static uint16_t       running;
+
+static uint32_t scan_count;
+static uint32_t scan_rate;
+static uint32_t scan_window;
+static uint32_t last_loop;
+
+static bool     oled_page;
+static bool     oled_page_drawn;
+static uint32_t oled_page_timer;
+
+static const char slot_names[PROFILE_SLOT_COUNT][5] PROGMEM = {"loop", "rec ", "ko  ", "caps", "tail", "lead", "oled", "tap ", "acl "};
+
+static uint8_t bucket_for(uint32_t elapsed_us) {
+    uint8_t bucket = 0;
+    for (elapsed_us >>= 1; elapsed_us && bucket < PROFILE_BUCKETS - 1; elapsed_us >>= 2) {
+        bucket++;
+    }
+    return bucket;
+}
+
+void profile_add(profile_slot_t slot, uint32_t elapsed_us) {
+    profile_stat_t *stat    = &stats[slot];
+    uint16_t        clamped = elapsed_us > UINT16_MAX ? UINT16_MAX : elapsed_us;
+
+    if (!stat->count || clamped < stat->min_us) stat->min_us = clamped;
+    if (clamped > stat->max_us) stat->max_us = clamped;
+    uint16_t *bucket = &stat->buckets[bucket_for(elapsed_us)];
+    if (*bucket < UINT16_MAX) (*bucket)++;
+    stat->count++;
+    stat->total_us += elapsed_us;
+}
+
+void profile_begin(profile_slot_t slot) {
+    started[slot] = us_timer_read();
+    running |= 1 << slot;
+}
+
+// A slot that was never begun, e.g. because a handler in between swallowed
+// the key event, is ignored instead of recording a stale interval.
+void profile_end(profile_slot_t slot) {
+    if (!(running & (1 << slot))) return;
+    running &= ~(1 << slot);
+    profile_add(slot, us_timer_read() - started[slot]);
+}
+
+void profile_scan_tick(void) {
+    scan_count++;
+}
+
+void profile_task(void) {
+    uint32_t now = us_timer_read();
+
+    if (last_loop) profile_add(PROFILE_LOOP, now - last_loop);
+    last_loop = now;
+
+    if (timer_elapsed32(scan_window) >= 1000) {
+        scan_rate   = scan_count;
+        scan_count  = 0;
+        scan_window = timer_read32();
+    }
+}
+
+void profile_reset(void) {
+    memset(stats, 0, sizeof(stats));
+    running   = 0;
+    last_loop = 0;
+}
+
+void profile_print(void) {
+    uprintf("scan rate: %lu/s\n", scan_rate);
+    for (uint8_t slot = 0; slot < PROFILE_SLOT_COUNT; slot++) {
+        const profile_stat_t *stat = &stats[slot];
+        const char           *unit = slot == PROFILE_TAP_HOLD ? "ms" : "us";
+
+        uprintf("%s: n=%lu avg=%lu%s min=%u%s max=%u%s |", slot_names[slot], stat->count, stat->count ? stat->total_us / stat->count : 0, unit, stat->min_us, unit, stat->max_us, unit);
+        for (uint8_t bucket = 0; bucket < PROFILE_BUCKETS; bucket++) {
+            uprintf(" %u", stat->buckets[bucket]);
+        }
+        uprintf("\n");
+    }
+}
+
+void profile_oled_page_toggle(void) {
+    oled_page       = !oled_page;
+    oled_page_drawn = false;
+}
+
+bool profile_oled_page_active(void) {
+    return oled_page;
+}
+
+static void render_slot_row(profile_slot_t slot, uint8_t line) {
+    const profile_stat_t *stat = &stats[slot];
+    uint32_t              avg  = stat->count ? stat->total_us / stat->count : 0;
+
+    oled_set_cursor(0, line);
+    oled_write_P(slot_names[slot], false);
+    oled_write_char(' ', false);
+    oled_write(get_u16_str(avg > UINT16_MAX ? UINT16_MAX : avg, ' '), false);
+    oled_write_char(' ', false);
+    oled_write(get_u16_str(stat->max_us, ' '), false);
+}
+
+// The scan rate, then one row per slot with the average and worst case in
+// microseconds. Redrawn every PROFILE_OLED_INTERVAL so the page stays cheap.
+void profile_render_oled(void) {
+    if (oled_page_drawn && timer_elapsed32(oled_page_timer) < PROFILE_OLED_INTERVAL) return;
+    if (!oled_page_drawn) oled_clear();
+    oled_page_drawn = true;
+    oled_page_timer = timer_read32();
+
+    oled_set_cursor(0, 0);
+    oled_write_P(PSTR("Scan/s "), false);
+    oled_write(get_u16_str(scan_rate > UINT16_MAX ? UINT16_MAX : scan_rate, ' '), false);
+
+    // Row 0 holds the scan rate, the loop period and the slots past the last
+    // row are left to the dumps.
+    for (uint8_t slot = 1; slot < PROFILE_SLOT_COUNT && slot < 8; slot++) {
+        render_slot_row(slot, slot);
+    }
+}
+
+// RAW_HID_PROFILE_READ [slot] answers with
+// [cmd][slot][slot count][count u32][total us u32][min us u16][max us u16][buckets 8 x u16].
+bool profile_raw_hid_receive(uint8_t *data, uint8_t length) {
+    switch (data[0]) {
+        case RAW_HID_PROFILE_READ: {
+            uint8_t slot = data[1];
+
+            memset(data + 2, 0, length - 2);
+            data[2] = PROFILE_SLOT_COUNT;
+            if (slot < PROFILE_SLOT_COUNT) {
+                const profile_stat_t *stat = &stats[slot];
+
+                raw_hid_put_u32(data + 3, stat->count);
+                raw_hid_put_u32(data + 7, stat->total_us);
+                raw_hid_put_u16(data + 11, stat->min_us);
+                raw_hid_put_u16(data + 13, stat->max_us);
+                for (uint8_t bucket = 0; bucket < PROFILE_BUCKETS; bucket++) {
+                    raw_hid_put_u16(data + 15 + 2 * bucket, stat->buckets[bucket]);
+                }
+            }
+            break;
+        }
+        case RAW_HID_PROFILE_SCAN_RATE:
+            raw_hid_put_u32(data + 1, scan_rate);
+            break;
+        case RAW_HID_PROFILE_RESET:
+            profile_reset();
+            break;
+        default:
+            return false;
+    }
+    raw_hid_send(data, length);
+    return true;
+}
@@ -0,0 +1,50 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+#include "us_timer.h"
+
+typedef enum {
+    PROFILE_LOOP,         // one main loop iteration, measured between housekeeping passes
+    PROFILE_RECORD,       // process_record_user()
+    PROFILE_KEY_OVERRIDE, // process_key_override_table()
+    PROFILE_CAPS_WORD,    // caps_word_press_user()
+    PROFILE_QUANTUM_TAIL, // handlers after process_record_user(): autocorrect, leader, unicode and the HID report
+    PROFILE_LEADER,       // leader trie walk and action
+    PROFILE_OLED,         // oled_task_user()
+    PROFILE_TAP_HOLD,     // mod-tap press until it is settled as tap or hold, in ms: min and max are 16 bit
+    PROFILE_AC_LOOKUP,    // autocorrect overlay index lookup, without typing the correction
+    PROFILE_SLOT_COUNT,
+} profile_slot_t;
+
+// Histogram buckets grow by 4x: <2, <8, <32, <128, <512, <2048, <8192 and >=8192 us,
+// or ms for PROFILE_TAP_HOLD.
+#define PROFILE_BUCKETS 8
+
+#ifdef PROFILE_ENABLE
+#    define PROFILE_BEGIN(slot) profile_begin(slot)
+#    define PROFILE_END(slot) profile_end(slot)
+
+void profile_begin(profile_slot_t slot);
+void profile_end(profile_slot_t slot);
+// Adds a duration measured elsewhere.
+void profile_add(profile_slot_t slot, uint32_t elapsed_us);
+
+// Call from matrix_scan_user() and housekeeping_task_user().
+void profile_scan_tick(void);
+void profile_task(void);
+
+void profile_reset(void);
+void profile_print(void);
+
+void profile_oled_page_toggle(void);
+bool profile_oled_page_active(void);
+void profile_render_oled(void);
+
+bool profile_raw_hid_receive(uint8_t *data, uint8_t length);
+#else
+#    define PROFILE_BEGIN(slot)
+#    define PROFILE_END(slot)
+#endif
@@ -0,0 +1,42 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+// First byte of every raw HID report exchanged with the tools/ scripts. The
+// keyboard answers each request with one report that starts with the same
+// byte, or with RAW_HID_UNHANDLED if no module knows the command. Multi-byte
+// fields are little endian.
+enum raw_hid_command {
+    RAW_HID_PROFILE_READ = 0x50,
+    RAW_HID_PROFILE_SCAN_RATE,
+    RAW_HID_PROFILE_RESET,
+    RAW_HID_KEYLOG_START = 0x60,
+    RAW_HID_KEYLOG_STOP,
+    RAW_HID_KEYLOG_CLEAR,
+    RAW_HID_KEYLOG_STATUS,
+    RAW_HID_KEYLOG_READ,
+    RAW_HID_STATUS_SYNC_STATS = 0x70,
+    RAW_HID_IDLE_STATS = 0x80,
+    RAW_HID_IDLE_RESET,
+    RAW_HID_TYPING_STATS_READ = 0x90,
+    RAW_HID_TYPING_STATS_RESET,
+    RAW_HID_AC_OVERLAY_ADD = 0xA0,
+    RAW_HID_AC_OVERLAY_DELETE,
+    RAW_HID_AC_OVERLAY_LIST,
+    RAW_HID_AC_OVERLAY_CLEAR,
+    RAW_HID_TYPING_INTERVAL = 0xB0,
+    RAW_HID_UNHANDLED = 0xFF,
+};
+
+static inline void raw_hid_put_u16(uint8_t *data, uint16_t value) {
+    data[0] = value & 0xFF;
+    data[1] = value >> 8;
+}
+
+static inline void raw_hid_put_u32(uint8_t *data, uint32_t value) {
+    raw_hid_put_u16(data, value & 0xFFFF);
+    raw_hid_put_u16(data + 2, value >> 16);
+}
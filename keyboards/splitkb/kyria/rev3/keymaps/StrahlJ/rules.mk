@@ -1,16 +1,61 @@
+# Directory of this keymap, taken before any other makefile is included.
+STRAHLJ_KEYMAP_DIR := $(patsubst %/,%,$(dir $(lastword $(MAKEFILE_LIST))))
+
 OLED_ENABLE = yes
 ENCODER_ENABLE = no       # Enables the use of one or more encoders
 RGB_MATRIX_ENABLE = no     # Disable keyboard RGB matrix, as it is enabled by default on rev3
 RGBLIGHT_ENABLE = no      # Enable keyboard RGB underglow
 CONVERT_TO=liatris
 CAPS_WORD_ENABLE = yes
-MOUSEKEY_ENABLE = yes
+MOUSEKEY_ENABLE = no       # Replaced by mouse_engine.c
+MOUSE_ENABLE = yes
 LAYER_LOCK_ENABLE = yes
-KEY_OVERRIDE_ENABLE = yes
+KEY_OVERRIDE_ENABLE = no  # Replaced by key_override_table.c
 LEADER_ENABLE = yes
 SEND_STRING_ENABLE = yes
 AUTOCORRECT_ENABLE = yes
-DYNAMIC_MACRO_ENABLE = yes
+DYNAMIC_MACRO_ENABLE = no  # Replaced by dyn_macro.c
 UNICODE_COMMON = yes
 UNICODEMAP_ENABLE = yes
 WPM_ENABLE = yes
+DEBOUNCE_TYPE = asym_eager_defer_pk  # Presses are reported on the first scan, releases after DEBOUNCE ms
+PROFILE_ENABLE = no       # Hook latency and scan rate statistics, read with tools/profile_dump.py
+KEYLOG_ENABLE = no        # Key event recorder, read with tools/keylog_dump.py
+
+SRC += bitmap_rle.c
+SRC += leader_table.c
+SRC += key_override_table.c
+SRC += layer_cache.c
+SRC += fast_combo.c
+SRC += send_string_fast.c
+SRC += unicode_fast.c
+SRC += user_data.c
+SRC += dyn_macro.c
+SRC += status_state.c
+SRC += status_sync.c
+SRC += idle_governor.c
+SRC += mouse_engine.c
+SRC += typing_stats.c
+SRC += ac_overlay.c
+
+ifeq ($(strip $(PROFILE_ENABLE)), yes)
+    SRC += profile.c
+    OPT_DEFS += -DPROFILE_ENABLE
+    RAW_ENABLE = yes
+    CONSOLE_ENABLE = yes
+endif
+
+ifeq ($(strip $(KEYLOG_ENABLE)), yes)
+    SRC += keylog.c
+    OPT_DEFS += -DKEYLOG_ENABLE
+    RAW_ENABLE = yes
+endif
+
+# Rebuild autocorrect_data.h whenever ac_dict.txt is newer than it.
+ifneq ($(shell test $(STRAHLJ_KEYMAP_DIR)/ac_dict.txt -nt $(STRAHLJ_KEYMAP_DIR)/autocorrect_data.h && echo stale),)
+    $(info Generating autocorrect_data.h from ac_dict.txt)
+    AUTOCORRECT_GENERATE := $(shell python3 $(STRAHLJ_KEYMAP_DIR)/tools/autocorrect_dawg.py $(STRAHLJ_KEYMAP_DIR)/ac_dict.txt -o $(STRAHLJ_KEYMAP_DIR)/autocorrect_data.h 2>&1 || echo FAILED)
+    ifneq ($(findstring FAILED,$(AUTOCORRECT_GENERATE)),)
+        $(error Could not generate autocorrect_data.h: $(AUTOCORRECT_GENERATE))
+    endif
+endif
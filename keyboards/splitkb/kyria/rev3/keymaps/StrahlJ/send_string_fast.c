@@ -0,0 +1,102 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "send_string.h"
+#include "send_string_fast.h"
+
+static uint8_t  interval = SEND_STRING_FAST_INTERVAL;
+static uint8_t  pacing;
+static uint16_t reports;
+static uint8_t  saved_mods;
+static uint8_t  pressed_key; // the key this module holds down, if any
+
+void send_string_fast_set_interval(uint8_t ms) {
+    interval = ms;
+}
+
+uint8_t send_string_fast_get_interval(void) {
+    return interval;
+}
+
+static void send_report(void) {
+    send_keyboard_report();
+    reports++;
+    if (pacing) wait_ms(pacing);
+}
+
+void send_keys_fast_begin(uint8_t report_interval) {
+    pacing      = report_interval;
+    reports     = 0;
+    pressed_key = 0;
+    // Held modifiers would change what is typed. Keys the user holds stay
+    // in the report.
+    saved_mods = get_mods();
+    clear_mods();
+}
+
+// USB HID doesn't order the changes within one report, so a report never
+// presses a key together with anything that changes its meaning. The
+// previous key is let go in the report that presses the next one, unless it
+// is the same key, and other modifiers get a report of their own.
+void send_keys_fast_add(uint8_t keycode, uint8_t mods) {
+    if (pressed_key && (pressed_key == keycode || mods != get_weak_mods())) {
+        del_key(pressed_key);
+        pressed_key = 0;
+        if (mods == get_weak_mods()) send_report();
+    }
+    if (mods != get_weak_mods()) {
+        set_weak_mods(mods);
+        send_report();
+    }
+    if (pressed_key) del_key(pressed_key);
+    add_key(keycode);
+    pressed_key = keycode;
+    send_report();
+}
+
+void send_keys_fast_add_char(char ascii) {
+    if ((uint8_t)ascii > 127) return;
+
+    uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii]);
+    if (!keycode) return;
+
+    if (PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii)) {
+        send_keys_fast_flush();
+        send_char(ascii);
+        return;
+    }
+
+    uint8_t mods = (PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii) ? MOD_BIT(KC_LSFT) : 0) | (PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii) ? MOD_BIT(KC_RALT) : 0);
+    send_keys_fast_add(keycode, mods);
+}
+
+void send_keys_fast_flush(void) {
+    if (!pressed_key && !get_weak_mods()) return;
+    if (pressed_key) del_key(pressed_key);
+    pressed_key = 0;
+    clear_weak_mods();
+    send_report();
+}
+
+uint16_t send_keys_fast_end(void) {
+    send_keys_fast_flush();
+    set_mods(saved_mods);
+    if (saved_mods) send_keyboard_report();
+    return reports;
+}
+
+uint16_t send_string_fast(const char *str) {
+    send_keys_fast_begin(interval);
+    for (; *str; str++) {
+        char ascii = *str;
+
+        if (ascii == SS_TAP_CODE || ascii == SS_DOWN_CODE || ascii == SS_UP_CODE || ascii == SS_DELAY_CODE) {
+            send_keys_fast_flush();
+            send_string(str);
+            break;
+        }
+        send_keys_fast_add_char(ascii);
+    }
+    return send_keys_fast_end();
+}
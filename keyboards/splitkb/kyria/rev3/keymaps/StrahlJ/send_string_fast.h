@@ -0,0 +1,35 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+// Delay after every report in ms. 1 ms matches the USB polling interval, so
+// no report is overwritten before the host has read it.
+#ifndef SEND_STRING_FAST_INTERVAL
+#    define SEND_STRING_FAST_INTERVAL 1
+#endif
+
+// Types `str` like send_string() with the keymap's sendstring LUTs, in about
+// one report per character instead of two or more: each report releases the
+// previous key and presses the next. Modifiers are only changed when the next
+// key needs others. Returns the number of reports sent, not counting the
+// ones of dead keys and SS_* escape codes, which go through send_char() and
+// send_string().
+uint16_t send_string_fast(const char *str);
+
+void    send_string_fast_set_interval(uint8_t ms);
+uint8_t send_string_fast_get_interval(void);
+
+// The batching behind send_string_fast(), for other modules that type. Keys
+// added between begin and end are sent the same way, and `report_interval`
+// ms pass after every report. Held modifiers are lifted until end(), held
+// keys stay down. add_char() takes an ASCII character through the
+// sendstring LUTs, flush() sends what is queued and releases the modifiers,
+// e.g. before a send_char() of its own. end() returns the number of reports.
+void     send_keys_fast_begin(uint8_t report_interval);
+void     send_keys_fast_add(uint8_t keycode, uint8_t mods);
+void     send_keys_fast_add_char(char ascii);
+void     send_keys_fast_flush(void);
+uint16_t send_keys_fast_end(void);
@@ -0,0 +1,34 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "ac_overlay.h"
+#include "status_state.h"
+
+void status_capture(status_state_t *state) {
+    state->layer        = get_highest_layer(layer_state | default_layer_state);
+    state->oneshot_mods = get_oneshot_mods();
+    state->flags        = 0;
+#ifdef CAPS_WORD_ENABLE
+    if (is_caps_word_on()) state->flags |= STATUS_CAPS_WORD;
+#endif
+#ifdef LEADER_ENABLE
+    if (leader_sequence_active()) state->flags |= STATUS_LEADER;
+#endif
+#ifdef AUTOCORRECT_ENABLE
+    if (autocorrect_is_enabled()) state->flags |= STATUS_AUTOCORRECT;
+#endif
+    state->leds  = host_keyboard_led_state().raw;
+    state->learn = ac_overlay_learn_state();
+#ifdef WPM_ENABLE
+    state->wpm = get_current_wpm();
+#else
+    state->wpm = 0;
+#endif
+#ifdef DEBUG_MATRIX_SCAN_RATE
+    uint32_t scan_rate = get_matrix_scan_rate();
+    state->scan_rate   = scan_rate > UINT16_MAX ? UINT16_MAX : scan_rate;
+#else
+    state->scan_rate = 0;
+#endif
+}
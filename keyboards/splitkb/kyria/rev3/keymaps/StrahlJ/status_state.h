@@ -0,0 +1,25 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+#define STATUS_CAPS_WORD 0x01
+#define STATUS_LEADER 0x02
+#define STATUS_AUTOCORRECT 0x04
+
+// Everything the status screen shows, captured in one go so rendering never
+// has to call into the key processing code.
+typedef struct {
+    uint8_t  layer;
+    uint8_t  oneshot_mods;
+    uint8_t  flags; // STATUS_*
+    uint8_t  leds;
+    uint8_t  wpm;
+    uint8_t  learn; // ac_overlay_learn_state_t
+    uint16_t scan_rate;
+} status_state_t;
+
+// Fills `state` from the current keyboard state.
+void status_capture(status_state_t *state);
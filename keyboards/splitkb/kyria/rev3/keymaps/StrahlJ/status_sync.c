@@ -0,0 +1,125 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "transactions.h"
+#include "raw_hid_commands.h"
+#include "status_sync.h"
+
+// Message: [version][field mask][changed fields in mask order]. A slave with
+// another version ignores the message, so mismatched firmware on the two
+// halves shows stale data instead of garbage.
+#define STATUS_SYNC_VERSION 1
+
+#define STATUS_SYNC_LAYER 0x01
+#define STATUS_SYNC_ONESHOT_MODS 0x02
+#define STATUS_SYNC_FLAGS 0x04
+#define STATUS_SYNC_WPM 0x08
+#define STATUS_SYNC_ALL (STATUS_SYNC_LAYER | STATUS_SYNC_ONESHOT_MODS | STATUS_SYNC_FLAGS | STATUS_SYNC_WPM)
+#define STATUS_SYNC_MAX_MESSAGE 6
+
+// Only the flags the slave's mirror draws. Leader and autocorrect change with
+// every leader sequence and would cost a message each time for nothing.
+#define STATUS_SYNC_FLAGS_SHOWN STATUS_CAPS_WORD
+
+// What one transaction_rpc_send() puts on the wire: four transactions (RPC
+// info, request, call, response) of an id byte and a handshake byte each, the
+// 4 byte RPC info, and both RPC buffers, which are sent whole.
+#ifndef RPC_M2S_BUFFER_SIZE
+#    define RPC_M2S_BUFFER_SIZE 32
+#endif
+#ifndef RPC_S2M_BUFFER_SIZE
+#    define RPC_S2M_BUFFER_SIZE 32
+#endif
+#define STATUS_SYNC_WIRE_BYTES (4 * 2 + 4 + RPC_M2S_BUFFER_SIZE + RPC_S2M_BUFFER_SIZE)
+
+_Static_assert(STATUS_SYNC_MAX_MESSAGE <= RPC_M2S_BUFFER_SIZE, "status message does not fit RPC_M2S_BUFFER_SIZE");
+
+static status_state_t synced; // master: what the slave has, slave: what was received
+static bool           synced_valid;
+static uint16_t       last_sent;
+static uint16_t       last_full;
+
+// Link usage in bytes on the wire, latched once per second. The full figure
+// is what sending every field on every housekeeping pass would have cost.
+static uint32_t bytes, full_bytes, messages;
+static uint32_t bytes_rate, full_bytes_rate, messages_rate;
+static uint16_t rate_timer;
+
+static void status_sync_slave_handler(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    const uint8_t *message = in_data;
+    uint8_t        i       = 2;
+
+    if (in_buflen < 2 || message[0] != STATUS_SYNC_VERSION) return;
+
+    uint8_t mask = message[1];
+    if ((mask & STATUS_SYNC_LAYER) && i < in_buflen) synced.layer = message[i++];
+    if ((mask & STATUS_SYNC_ONESHOT_MODS) && i < in_buflen) synced.oneshot_mods = message[i++];
+    if ((mask & STATUS_SYNC_FLAGS) && i < in_buflen) synced.flags = message[i++];
+    if ((mask & STATUS_SYNC_WPM) && i < in_buflen) synced.wpm = message[i++];
+}
+
+const status_state_t *status_sync_received(void) {
+    return &synced;
+}
+
+void status_sync_init(void) {
+    transaction_register_rpc(USER_SYNC_STATUS, status_sync_slave_handler);
+}
+
+static void count_rates(void) {
+    full_bytes += STATUS_SYNC_WIRE_BYTES;
+    if (timer_elapsed(rate_timer) < 1000) return;
+    rate_timer      = timer_read();
+    bytes_rate      = bytes;
+    full_bytes_rate = full_bytes;
+    messages_rate   = messages;
+    bytes = full_bytes = messages = 0;
+}
+
+void status_sync_task(const status_state_t *state) {
+    count_rates();
+    if (timer_elapsed(last_sent) < STATUS_SYNC_INTERVAL) return;
+
+    uint8_t mask = 0;
+    if (!synced_valid || timer_elapsed(last_full) >= STATUS_SYNC_RESYNC) {
+        mask = STATUS_SYNC_ALL;
+    } else {
+        if (state->layer != synced.layer) mask |= STATUS_SYNC_LAYER;
+        if (state->oneshot_mods != synced.oneshot_mods) mask |= STATUS_SYNC_ONESHOT_MODS;
+        if ((state->flags ^ synced.flags) & STATUS_SYNC_FLAGS_SHOWN) mask |= STATUS_SYNC_FLAGS;
+        if (state->wpm != synced.wpm) mask |= STATUS_SYNC_WPM;
+    }
+    if (!mask) return;
+
+    uint8_t message[STATUS_SYNC_MAX_MESSAGE] = {STATUS_SYNC_VERSION, mask};
+    uint8_t size                             = 2;
+    if (mask & STATUS_SYNC_LAYER) message[size++] = state->layer;
+    if (mask & STATUS_SYNC_ONESHOT_MODS) message[size++] = state->oneshot_mods;
+    if (mask & STATUS_SYNC_FLAGS) message[size++] = state->flags & STATUS_SYNC_FLAGS_SHOWN;
+    if (mask & STATUS_SYNC_WPM) message[size++] = state->wpm;
+
+    last_sent = timer_read();
+    // A failed transfer leaves `synced` alone, so the same fields go out next time.
+    if (!transaction_rpc_send(USER_SYNC_STATUS, size, message)) return;
+
+    synced       = *state;
+    synced_valid = true;
+    if (mask == STATUS_SYNC_ALL) last_full = last_sent;
+    bytes += STATUS_SYNC_WIRE_BYTES;
+    messages++;
+}
+
+#ifdef RAW_ENABLE
+// RAW_HID_STATUS_SYNC_STATS answers [cmd][bytes/s u32][full state bytes/s u32][messages/s u32],
+// bytes as sent on the wire.
+bool status_sync_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (data[0] != RAW_HID_STATUS_SYNC_STATS) return false;
+
+    raw_hid_put_u32(data + 1, bytes_rate);
+    raw_hid_put_u32(data + 5, full_bytes_rate);
+    raw_hid_put_u32(data + 9, messages_rate);
+    raw_hid_send(data, length);
+    return true;
+}
+#endif
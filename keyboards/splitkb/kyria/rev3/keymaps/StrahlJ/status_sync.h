@@ -0,0 +1,33 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+#include "status_state.h"
+
+// Minimum time between two messages, changes in between are sent together.
+#ifndef STATUS_SYNC_INTERVAL
+#    define STATUS_SYNC_INTERVAL 50
+#endif
+
+// The full state is sent again this often, so a slave that restarted catches up.
+#ifndef STATUS_SYNC_RESYNC
+#    define STATUS_SYNC_RESYNC 2000
+#endif
+
+// Registers the slave side handler, call from keyboard_post_init_user().
+void status_sync_init(void);
+
+// Master side, call from housekeeping_task_user() with the state just
+// captured. Sends the fields that differ from what the slave has.
+void status_sync_task(const status_state_t *state);
+
+// Slave side, the state last received. Every field is a single byte the
+// handler stores on its own, so a frame drawn while a message comes in mixes
+// at most two consecutive states and the next frame catches up.
+const status_state_t *status_sync_received(void);
+
+#ifdef RAW_ENABLE
+bool status_sync_raw_hid_receive(uint8_t *data, uint8_t length);
+#endif
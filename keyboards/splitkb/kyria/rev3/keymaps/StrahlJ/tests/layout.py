@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Write info_config.h and kyria.h for the host build from the keyboard's
+keyboard.json, so the simulated matrix is the board's: MATRIX_ROWS and
+MATRIX_COLS from the matrix pins, LAYOUT from the matrix positions of the
+LAYOUT (or first) layout. qmk/rev3/ holds the same files for builds outside
+a qmk_firmware checkout.
+
+Usage:
+    tests/layout.py keyboard.json output_dir
+"""
+
+import argparse
+import json
+import os
+import sys
+
+HEADER = '// Generated by tests/layout.py from {source}, do not edit.\n\n#pragma once\n\n'
+
+
+def matrix_size(info, keys):
+    pins = info.get('matrix_pins', {})
+    rows, cols = len(pins.get('rows', [])), len(pins.get('cols', []))
+    if not rows or not cols:
+        rows = max(row for row, _ in keys) + 1
+        cols = max(col for _, col in keys) + 1
+    elif info.get('split', {}).get('enabled'):
+        rows *= 2
+    return rows, cols
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('info', help="the keyboard's keyboard.json or info.json")
+    parser.add_argument('output', help='directory for info_config.h and kyria.h')
+    args = parser.parse_args()
+
+    with open(args.info, encoding='utf-8') as f:
+        info = json.load(f)
+    layouts = info.get('layouts')
+    if not layouts:
+        sys.exit(f'{args.info}: no layouts')
+    layout = layouts.get(info.get('layout_aliases', {}).get('LAYOUT', 'LAYOUT')) or next(iter(layouts.values()))
+    keys = [tuple(key['matrix']) for key in layout['layout']]
+    rows, cols = matrix_size(info, keys)
+
+    matrix = [['KC_NO'] * cols for _ in range(rows)]
+    for index, (row, col) in enumerate(keys):
+        if row >= rows or col >= cols:
+            sys.exit(f'{args.info}: key {index} at [{row}, {col}] is outside the {rows}x{cols} matrix')
+        matrix[row][col] = f'k{index:02}'
+
+    os.makedirs(args.output, exist_ok=True)
+    source = os.path.relpath(args.info)
+    with open(os.path.join(args.output, 'info_config.h'), 'w', encoding='utf-8') as f:
+        f.write(HEADER.format(source=source))
+        f.write(f'#define MATRIX_ROWS {rows}\n#define MATRIX_COLS {cols}\n')
+    with open(os.path.join(args.output, 'kyria.h'), 'w', encoding='utf-8') as f:
+        f.write(HEADER.format(source=source))
+        f.write('#include "quantum.h"\n\n')
+        f.write(f'#define LAYOUT({", ".join(f"k{index:02}" for index in range(len(keys)))}) {{ \\\n')
+        f.write(', \\\n'.join(f'    {{ {", ".join(row)} }}' for row in matrix))
+        f.write(' \\\n}\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,2037 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Stand-in for the QMK core the keymap runs on, for host tests. Each part
+// follows the QMK source it is named after closely enough for the keymap's
+// modules to see the same calls, reports and ordering. It is a model, though:
+// where it simplifies, the comment says so. Differences in behaviour found on
+// the keyboard belong here first.
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <time.h>
+#include "quantum.h"
+#include "../sim.h"
+#include "autocorrect_data.h"
+
+#ifndef ONESHOT_TIMEOUT
+#    define ONESHOT_TIMEOUT 0
+#endif
+#ifndef LEADER_TIMEOUT
+#    define LEADER_TIMEOUT 300
+#endif
+#ifndef CAPS_WORD_IDLE_TIMEOUT
+#    define CAPS_WORD_IDLE_TIMEOUT 5000
+#endif
+#ifndef TAP_HOLD_CAPS_DELAY
+#    define TAP_HOLD_CAPS_DELAY 80
+#endif
+#ifndef EECONFIG_USER_DATA_SIZE
+#    define EECONFIG_USER_DATA_SIZE 0
+#endif
+#ifndef EECONFIG_USER_DATA_VERSION
+#    define EECONFIG_USER_DATA_VERSION (EECONFIG_USER_DATA_SIZE)
+#endif
+
+static void process_record_tapping(keyrecord_t *record);
+
+// Virtual clock
+
+static uint64_t clock_us;
+
+uint16_t timer_read(void) {
+    return (uint16_t)(clock_us / 1000);
+}
+
+uint32_t timer_read32(void) {
+    return (uint32_t)(clock_us / 1000);
+}
+
+uint16_t timer_elapsed(uint16_t last) {
+    return TIMER_DIFF_16(timer_read(), last);
+}
+
+uint32_t timer_elapsed32(uint32_t last) {
+    return TIMER_DIFF_32(timer_read32(), last);
+}
+
+void wait_ms(uint32_t ms) {
+    clock_us += (uint64_t)ms * 1000;
+}
+
+void wait_us(uint32_t us) {
+    clock_us += us;
+}
+
+void timer_advance_us(uint32_t us) {
+    clock_us += us;
+}
+
+uint64_t timer_now_us(void) {
+    return clock_us;
+}
+
+// Hook timing
+
+sim_hook_stat_t sim_hooks[SIM_HOOK_COUNT];
+
+const char *sim_hook_names[SIM_HOOK_COUNT] = {
+    [SIM_HOOK_PRE_PROCESS_RECORD]  = "pre_process_record_user",
+    [SIM_HOOK_PROCESS_RECORD]      = "process_record_user",
+    [SIM_HOOK_POST_PROCESS_RECORD] = "post_process_record_user",
+    [SIM_HOOK_MATRIX_SCAN]         = "matrix_scan_user",
+    [SIM_HOOK_HOUSEKEEPING]        = "housekeeping_task_user",
+    [SIM_HOOK_OLED_TASK]           = "oled_task_user",
+    [SIM_HOOK_LAYER_STATE_SET]     = "layer_state_set_user",
+    [SIM_HOOK_CAPS_WORD_PRESS]     = "caps_word_press_user",
+    [SIM_HOOK_LEADER_END]          = "leader_end_user",
+    [SIM_HOOK_TAPPING_TERM]        = "get_tapping_term",
+    [SIM_HOOK_AUTOCORRECT]         = "process_autocorrect_user",
+};
+
+static uint64_t host_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+static void hook_add(sim_hook_t hook, uint64_t ns) {
+    sim_hooks[hook].calls++;
+    sim_hooks[hook].total_ns += ns;
+    if (ns > sim_hooks[hook].max_ns) sim_hooks[hook].max_ns = ns;
+}
+
+#define TIMED(hook, call)                    \
+    ({                                       \
+        uint64_t    timed_start_ = host_ns(); \
+        __auto_type timed_result_ = (call);  \
+        hook_add(hook, host_ns() - timed_start_); \
+        timed_result_;                       \
+    })
+
+#define TIMED_VOID(hook, call)               \
+    do {                                     \
+        uint64_t timed_start_ = host_ns();   \
+        call;                                \
+        hook_add(hook, host_ns() - timed_start_); \
+    } while (0)
+
+// Nesting depth of key processing, for writes made while a key is handled.
+static uint8_t key_depth;
+
+// Weak user hooks, as in QMK.
+
+__attribute__((weak)) bool pre_process_record_user(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+__attribute__((weak)) bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+__attribute__((weak)) void post_process_record_user(uint16_t keycode, keyrecord_t *record) {}
+__attribute__((weak)) void keyboard_post_init_user(void) {}
+__attribute__((weak)) void matrix_scan_user(void) {}
+__attribute__((weak)) void housekeeping_task_user(void) {}
+__attribute__((weak)) void suspend_power_down_user(void) {}
+__attribute__((weak)) void suspend_wakeup_init_user(void) {}
+__attribute__((weak)) layer_state_t layer_state_set_user(layer_state_t state) {
+    return state;
+}
+__attribute__((weak)) layer_state_t default_layer_state_set_user(layer_state_t state) {
+    return state;
+}
+__attribute__((weak)) uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    return TAPPING_TERM;
+}
+__attribute__((weak)) bool caps_word_press_user(uint16_t keycode) {
+    return true;
+}
+__attribute__((weak)) void leader_start_user(void) {}
+__attribute__((weak)) void leader_end_user(void) {}
+__attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    return true;
+}
+__attribute__((weak)) bool process_autocorrect_user(uint16_t *keycode, keyrecord_t *record, uint8_t *typo_buffer_size, uint8_t *mods) {
+    return process_autocorrect_default_handler(keycode, record, typo_buffer_size, mods);
+}
+__attribute__((weak)) oled_rotation_t oled_init_user(oled_rotation_t rotation) {
+    return rotation;
+}
+__attribute__((weak)) bool oled_task_user(void) {
+    return true;
+}
+__attribute__((weak)) void raw_hid_receive(uint8_t *data, uint8_t length) {}
+
+// Flow tap's default from QMK: both the previous key and the tap-hold key's
+// tap keycode must be letters, space or common punctuation, and no Ctrl, Alt
+// or GUI may be held.
+__attribute__((weak)) bool is_flow_tap_key(uint16_t keycode) {
+    if ((get_mods() & (MOD_MASK_CG | MOD_BIT(KC_LALT))) != 0) return false;
+    if (IS_QK_MOD_TAP(keycode)) keycode = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+    if (IS_QK_LAYER_TAP(keycode)) keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+    switch (keycode) {
+        case KC_SPC:
+        case KC_A ... KC_Z:
+        case KC_DOT:
+        case KC_COMM:
+        case KC_SCLN:
+        case KC_SLSH:
+            return true;
+    }
+    return false;
+}
+
+__attribute__((weak)) uint16_t get_flow_tap_term(uint16_t keycode, keyrecord_t *record, uint16_t prev_keycode) {
+#ifdef FLOW_TAP_TERM
+    if (is_flow_tap_key(keycode) && is_flow_tap_key(prev_keycode)) return FLOW_TAP_TERM;
+#endif
+    return 0;
+}
+
+__attribute__((weak)) char chordal_hold_handedness(keypos_t key) {
+    return key.row < MATRIX_ROWS / 2 ? 'L' : 'R';
+}
+
+// Chordal hold's default: a hold needs keys from opposite hands, '*' keys
+// go with either.
+bool get_chordal_hold_default(keyrecord_t *tap_hold_record, keyrecord_t *other_record) {
+    if (other_record->event.key.row >= MATRIX_ROWS) return true;
+    char tap_hold = chordal_hold_handedness(tap_hold_record->event.key);
+    if (tap_hold == '*') return true;
+    char hand = chordal_hold_handedness(other_record->event.key);
+    return hand == '*' || hand != tap_hold;
+}
+
+__attribute__((weak)) bool get_chordal_hold(uint16_t tap_hold_keycode, keyrecord_t *tap_hold_record, uint16_t other_keycode, keyrecord_t *other_record) {
+    return get_chordal_hold_default(tap_hold_record, other_record);
+}
+
+// Host driver (host.c)
+
+static host_driver_t *driver;
+static uint16_t       last_system_usage;
+static uint16_t       last_consumer_usage;
+
+host_driver_t *host_get_driver(void) {
+    return driver;
+}
+
+void host_set_driver(host_driver_t *new_driver) {
+    driver = new_driver;
+}
+
+void host_keyboard_send(report_keyboard_t *report) {
+    if (driver) driver->send_keyboard(report);
+}
+
+void host_nkro_send(report_nkro_t *report) {
+    if (driver) driver->send_nkro(report);
+}
+
+void host_mouse_send(report_mouse_t *report) {
+    if (driver) driver->send_mouse(report);
+}
+
+static void host_extra_send(uint8_t report_id, uint16_t usage) {
+    report_extra_t report = {.report_id = report_id, .usage = usage};
+    if (driver) driver->send_extra(&report);
+}
+
+void host_system_send(uint16_t usage) {
+    if (usage == last_system_usage) return;
+    last_system_usage = usage;
+    host_extra_send(REPORT_ID_SYSTEM, usage);
+}
+
+void host_consumer_send(uint16_t usage) {
+    if (usage == last_consumer_usage) return;
+    last_consumer_usage = usage;
+    host_extra_send(REPORT_ID_CONSUMER, usage);
+}
+
+led_t host_keyboard_led_state(void) {
+    return (led_t){.raw = driver ? driver->keyboard_leds() : 0};
+}
+
+// Usage IDs of the system and consumer keycodes the keymap has.
+static uint16_t system_usage(uint8_t code) {
+    switch (code) {
+        case KC_SYSTEM_POWER:
+            return 0x81;
+        case KC_SYSTEM_SLEEP:
+            return 0x82;
+        default:
+            return 0x83;
+    }
+}
+
+static uint16_t consumer_usage(uint8_t code) {
+    static const uint16_t usages[] = {
+        [KC_AUDIO_MUTE - KC_AUDIO_MUTE]         = 0x0E2,
+        [KC_AUDIO_VOL_UP - KC_AUDIO_MUTE]       = 0x0E9,
+        [KC_AUDIO_VOL_DOWN - KC_AUDIO_MUTE]     = 0x0EA,
+        [KC_MEDIA_NEXT_TRACK - KC_AUDIO_MUTE]   = 0x0B5,
+        [KC_MEDIA_PREV_TRACK - KC_AUDIO_MUTE]   = 0x0B6,
+        [KC_MEDIA_STOP - KC_AUDIO_MUTE]         = 0x0B7,
+        [KC_MEDIA_PLAY_PAUSE - KC_AUDIO_MUTE]   = 0x0CD,
+        [KC_MEDIA_SELECT - KC_AUDIO_MUTE]       = 0x183,
+        [KC_MEDIA_EJECT - KC_AUDIO_MUTE]        = 0x0B8,
+        [KC_MAIL - KC_AUDIO_MUTE]               = 0x18A,
+        [KC_CALCULATOR - KC_AUDIO_MUTE]         = 0x192,
+        [KC_MY_COMPUTER - KC_AUDIO_MUTE]        = 0x194,
+        [KC_WWW_SEARCH - KC_AUDIO_MUTE]         = 0x221,
+        [KC_WWW_HOME - KC_AUDIO_MUTE]           = 0x223,
+        [KC_WWW_BACK - KC_AUDIO_MUTE]           = 0x224,
+        [KC_WWW_FORWARD - KC_AUDIO_MUTE]        = 0x225,
+        [KC_WWW_STOP - KC_AUDIO_MUTE]           = 0x226,
+        [KC_WWW_REFRESH - KC_AUDIO_MUTE]        = 0x227,
+        [KC_WWW_FAVORITES - KC_AUDIO_MUTE]      = 0x22A,
+        [KC_MEDIA_FAST_FORWARD - KC_AUDIO_MUTE] = 0x0B3,
+        [KC_MEDIA_REWIND - KC_AUDIO_MUTE]       = 0x0B4,
+        [KC_BRIGHTNESS_UP - KC_AUDIO_MUTE]      = 0x06F,
+        [KC_BRIGHTNESS_DOWN - KC_AUDIO_MUTE]    = 0x070,
+    };
+    return usages[code - KC_AUDIO_MUTE];
+}
+
+// Modifiers and the keyboard report (action_util.c, report.c)
+
+keymap_config_t keymap_config = {.oneshot_enable = true, .autocorrect_enable = true};
+
+static uint8_t           real_mods;
+static uint8_t           weak_mods;
+static uint8_t           oneshot_mods;
+static uint8_t           oneshot_locked_mods;
+static uint16_t          oneshot_time;
+static report_keyboard_t keyboard_report;
+static report_keyboard_t last_keyboard_report;
+static report_nkro_t     nkro_report = {.report_id = 6};
+static report_nkro_t     last_nkro_report = {.report_id = 6};
+
+uint8_t get_mods(void) {
+    return real_mods;
+}
+void add_mods(uint8_t mods) {
+    real_mods |= mods;
+}
+void del_mods(uint8_t mods) {
+    real_mods &= ~mods;
+}
+void set_mods(uint8_t mods) {
+    real_mods = mods;
+}
+void clear_mods(void) {
+    real_mods = 0;
+}
+
+uint8_t get_weak_mods(void) {
+    return weak_mods;
+}
+void add_weak_mods(uint8_t mods) {
+    weak_mods |= mods;
+}
+void del_weak_mods(uint8_t mods) {
+    weak_mods &= ~mods;
+}
+void set_weak_mods(uint8_t mods) {
+    weak_mods = mods;
+}
+void clear_weak_mods(void) {
+    weak_mods = 0;
+}
+
+uint8_t get_oneshot_mods(void) {
+    return oneshot_mods;
+}
+void add_oneshot_mods(uint8_t mods) {
+    if ((oneshot_mods & mods) != mods) {
+        oneshot_time = timer_read();
+        oneshot_mods |= mods;
+    }
+}
+void del_oneshot_mods(uint8_t mods) {
+    oneshot_mods &= ~mods;
+}
+void set_oneshot_mods(uint8_t mods) {
+    if (oneshot_mods != mods) {
+        oneshot_time = timer_read();
+        oneshot_mods = mods;
+    }
+}
+void clear_oneshot_mods(void) {
+    oneshot_mods = 0;
+}
+uint8_t get_oneshot_locked_mods(void) {
+    return oneshot_locked_mods;
+}
+
+static bool has_oneshot_mods_timed_out(void) {
+    return ONESHOT_TIMEOUT > 0 && oneshot_mods && timer_elapsed(oneshot_time) >= ONESHOT_TIMEOUT;
+}
+
+static bool nkro_active(void) {
+#ifdef NKRO_ENABLE
+    return keymap_config.nkro;
+#else
+    return false;
+#endif
+}
+
+// The 6KRO report takes a key in the first free slot, as QMK's add_key_byte().
+void add_key(uint8_t key) {
+    if (nkro_active()) {
+        if ((key >> 3) < NKRO_REPORT_BITS) nkro_report.bits[key >> 3] |= 1 << (key & 7);
+        return;
+    }
+    int8_t empty = -1;
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keyboard_report.keys[i] == key) return;
+        if (empty == -1 && keyboard_report.keys[i] == 0) empty = i;
+    }
+    if (empty != -1) keyboard_report.keys[empty] = key;
+}
+
+void del_key(uint8_t key) {
+    if (nkro_active()) {
+        if ((key >> 3) < NKRO_REPORT_BITS) nkro_report.bits[key >> 3] &= ~(1 << (key & 7));
+        return;
+    }
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keyboard_report.keys[i] == key) keyboard_report.keys[i] = 0;
+    }
+}
+
+void clear_keys(void) {
+    memset(keyboard_report.keys, 0, sizeof(keyboard_report.keys));
+    memset(nkro_report.bits, 0, sizeof(nkro_report.bits));
+}
+
+bool has_anykey(void) {
+    if (nkro_active()) {
+        for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+            if (nkro_report.bits[i]) return true;
+        }
+        return false;
+    }
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keyboard_report.keys[i]) return true;
+    }
+    return false;
+}
+
+// Sends the report if it differs from the last one, and uses up one-shot mods
+// once a key goes out with them.
+void send_keyboard_report(void) {
+    uint8_t mods = real_mods | weak_mods;
+
+    if (oneshot_mods) {
+        if (has_oneshot_mods_timed_out()) clear_oneshot_mods();
+        mods |= oneshot_mods;
+        if (has_anykey()) clear_oneshot_mods();
+    }
+    if (nkro_active()) {
+        nkro_report.mods = mods;
+        if (memcmp(&nkro_report, &last_nkro_report, sizeof(nkro_report)) != 0) {
+            last_nkro_report = nkro_report;
+            host_nkro_send(&nkro_report);
+        }
+        return;
+    }
+    keyboard_report.mods = mods;
+    if (memcmp(&keyboard_report, &last_keyboard_report, sizeof(keyboard_report)) != 0) {
+        last_keyboard_report = keyboard_report;
+        host_keyboard_send(&keyboard_report);
+    }
+}
+
+void clear_keyboard_but_mods(void) {
+    clear_keys();
+    send_keyboard_report();
+    host_system_send(0);
+    host_consumer_send(0);
+}
+
+void clear_keyboard(void) {
+    clear_mods();
+    clear_weak_mods();
+    clear_keyboard_but_mods();
+}
+
+void register_mods(uint8_t mods) {
+    if (mods) {
+        add_mods(mods);
+        send_keyboard_report();
+    }
+}
+
+void unregister_mods(uint8_t mods) {
+    if (mods) {
+        del_mods(mods);
+        send_keyboard_report();
+    }
+}
+
+void register_weak_mods(uint8_t mods) {
+    if (mods) {
+        add_weak_mods(mods);
+        send_keyboard_report();
+    }
+}
+
+void unregister_weak_mods(uint8_t mods) {
+    if (mods) {
+        del_weak_mods(mods);
+        send_keyboard_report();
+    }
+}
+
+// Keycode functions (action.c)
+
+void register_code(uint8_t code) {
+    if (code == KC_NO) return;
+    if (IS_BASIC_KEYCODE(code)) {
+        add_key(code);
+        send_keyboard_report();
+    } else if (IS_MODIFIER_KEYCODE(code)) {
+        add_mods(MOD_BIT(code));
+        send_keyboard_report();
+    } else if (IS_SYSTEM_KEYCODE(code)) {
+        host_system_send(system_usage(code));
+    } else if (IS_CONSUMER_KEYCODE(code)) {
+        host_consumer_send(consumer_usage(code));
+    }
+}
+
+void unregister_code(uint8_t code) {
+    if (code == KC_NO) return;
+    if (IS_BASIC_KEYCODE(code)) {
+        del_key(code);
+        send_keyboard_report();
+    } else if (IS_MODIFIER_KEYCODE(code)) {
+        del_mods(MOD_BIT(code));
+        send_keyboard_report();
+    } else if (IS_SYSTEM_KEYCODE(code)) {
+        host_system_send(0);
+    } else if (IS_CONSUMER_KEYCODE(code)) {
+        host_consumer_send(0);
+    }
+}
+
+void tap_code_delay(uint8_t code, uint16_t delay) {
+    register_code(code);
+    for (uint16_t i = delay; i > 0; i--) {
+        wait_ms(1);
+    }
+    unregister_code(code);
+}
+
+void tap_code(uint8_t code) {
+    tap_code_delay(code, code == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY);
+}
+
+// 5-bit keycode mods to an 8-bit report mask.
+static uint8_t mod_config_8bit(uint8_t mods) {
+    return (mods & 0x10) ? (uint8_t)((mods & 0x0F) << 4) : mods;
+}
+
+void register_code16(uint16_t code) {
+    uint8_t mods = mod_config_8bit(QK_MODS_GET_MODS(code));
+    uint8_t key  = QK_MODS_GET_BASIC_KEYCODE(code);
+
+    if (IS_MODIFIER_KEYCODE(key) || key == KC_NO) {
+        register_mods(mods);
+    } else {
+        register_weak_mods(mods);
+    }
+    register_code(key);
+}
+
+void unregister_code16(uint16_t code) {
+    uint8_t mods = mod_config_8bit(QK_MODS_GET_MODS(code));
+    uint8_t key  = QK_MODS_GET_BASIC_KEYCODE(code);
+
+    unregister_code(key);
+    if (IS_MODIFIER_KEYCODE(key) || key == KC_NO) {
+        unregister_mods(mods);
+    } else {
+        unregister_weak_mods(mods);
+    }
+}
+
+void tap_code16(uint16_t code) {
+    register_code16(code);
+    for (uint16_t i = (code == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY); i > 0; i--) {
+        wait_ms(1);
+    }
+    unregister_code16(code);
+}
+
+// Layers (action_layer.c) and layer lock
+
+layer_state_t        layer_state;
+layer_state_t        default_layer_state;
+static layer_state_t locked_layers;
+
+void layer_state_set(layer_state_t state) {
+    state       = TIMED(SIM_HOOK_LAYER_STATE_SET, layer_state_set_user(state));
+    layer_state = state;
+    locked_layers &= state;
+}
+
+bool layer_state_cmp(layer_state_t state, uint8_t layer) {
+    if (!state) return layer == 0;
+    return (state & ((layer_state_t)1 << layer)) != 0;
+}
+
+bool layer_state_is(uint8_t layer) {
+    return layer_state_cmp(layer_state, layer);
+}
+
+void layer_on(uint8_t layer) {
+    layer_state_set(layer_state | ((layer_state_t)1 << layer));
+}
+
+void layer_off(uint8_t layer) {
+    layer_state_set(layer_state & ~((layer_state_t)1 << layer));
+}
+
+void layer_invert(uint8_t layer) {
+    layer_state_set(layer_state ^ ((layer_state_t)1 << layer));
+}
+
+void layer_move(uint8_t layer) {
+    layer_state_set((layer_state_t)1 << layer);
+}
+
+void layer_clear(void) {
+    layer_state_set(0);
+}
+
+void default_layer_set(layer_state_t state) {
+    default_layer_state = default_layer_state_set_user(state);
+}
+
+uint8_t get_highest_layer(layer_state_t state) {
+    return state ? (uint8_t)(31 - __builtin_clz(state)) : 0;
+}
+
+bool is_layer_locked(uint8_t layer) {
+    return (locked_layers & ((layer_state_t)1 << layer)) != 0;
+}
+
+__attribute__((weak)) uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) return keycode_at_keymap_location(layer, key.row, key.col);
+    return KC_NO;
+}
+
+uint8_t layer_switch_get_layer(keypos_t key) {
+    layer_state_t layers = layer_state | default_layer_state;
+
+    for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
+        if (layers & ((layer_state_t)1 << i)) {
+            if (keymap_key_to_keycode(i, key) != KC_TRNS) return i;
+        }
+    }
+    return 0;
+}
+
+// Source layer cache: a release resolves on the layer its press did.
+static uint8_t source_layers[MATRIX_ROWS][MATRIX_COLS];
+
+uint16_t get_record_keycode(keyrecord_t *record, bool update_layer_cache) {
+    keypos_t key = record->event.key;
+    uint8_t  layer;
+
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        if (record->event.pressed) {
+            layer = layer_switch_get_layer(key);
+            if (update_layer_cache) source_layers[key.row][key.col] = layer;
+        } else {
+            layer = source_layers[key.row][key.col];
+        }
+    } else {
+        layer = layer_switch_get_layer(key);
+    }
+    return keymap_key_to_keycode(layer, key);
+}
+
+// One-shot layer (action_util.c). OSL keeps its layer on while held and
+// until the next key is pressed after it was released.
+
+static uint8_t  oneshot_layer;
+static bool     oneshot_layer_active;
+static bool     oneshot_layer_held;
+static bool     oneshot_layer_used;
+static uint16_t oneshot_layer_time;
+
+static void set_oneshot_layer(uint8_t layer) {
+    oneshot_layer        = layer;
+    oneshot_layer_active = true;
+    oneshot_layer_held   = true;
+    oneshot_layer_used   = false;
+    oneshot_layer_time   = timer_read();
+    layer_on(layer);
+}
+
+static void clear_oneshot_layer(void) {
+    if (!oneshot_layer_active) return;
+    oneshot_layer_active = false;
+    layer_off(oneshot_layer);
+}
+
+// Another key was pressed: the layer goes now, or on the OSL release.
+static void oneshot_layer_other_key(void) {
+    if (oneshot_layer_held) {
+        oneshot_layer_used = true;
+    } else {
+        clear_oneshot_layer();
+    }
+}
+
+static void layer_lock_invert(uint8_t layer) {
+    layer_state_t mask = (layer_state_t)1 << layer;
+
+    if (locked_layers & mask) {
+        locked_layers &= ~mask;
+        layer_off(layer);
+    } else {
+        if (oneshot_layer_active && oneshot_layer == layer) oneshot_layer_active = false;
+        layer_on(layer);
+        locked_layers |= mask;
+    }
+}
+
+// Caps word (process_caps_word.c)
+
+static bool     caps_word_active;
+static uint16_t caps_word_idle_timer;
+
+bool is_caps_word_on(void) {
+    return caps_word_active;
+}
+
+void caps_word_on(void) {
+    if (caps_word_active) return;
+    clear_mods();
+    clear_oneshot_mods();
+    caps_word_idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
+    caps_word_active     = true;
+}
+
+void caps_word_off(void) {
+    if (!caps_word_active) return;
+    unregister_weak_mods(MOD_MASK_SHIFT);
+    caps_word_active = false;
+}
+
+static bool process_caps_word(uint16_t keycode, keyrecord_t *record) {
+    if (keycode == CW_TOGG) {
+        if (record->event.pressed) {
+            if (caps_word_active) {
+                caps_word_off();
+            } else {
+                caps_word_on();
+            }
+        }
+        return false;
+    }
+
+    uint8_t mods = get_mods() | get_oneshot_mods();
+    if (!caps_word_active) {
+#ifdef BOTH_SHIFTS_TURNS_ON_CAPS_WORD
+        if (mods == MOD_MASK_SHIFT) caps_word_on();
+#endif
+        return true;
+    }
+    caps_word_idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
+    if (!record->event.pressed) return true;
+
+    if (!(mods & ~(MOD_MASK_SHIFT | MOD_BIT(KC_RALT)))) {
+        switch (keycode) {
+            case QK_MOMENTARY ... QK_MOMENTARY_MAX:
+            case QK_TO ... QK_TO_MAX:
+            case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:
+            case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:
+            case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:
+            case KC_RALT:
+            case OSM(MOD_RALT):
+                return true;
+            case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+                if (record->tap.count == 0) {
+                    switch (QK_MOD_TAP_GET_MODS(keycode)) {
+                        case MOD_LSFT:
+                            keycode = KC_LSFT;
+                            break;
+                        case MOD_RSFT:
+                            keycode = KC_RSFT;
+                            break;
+                        case MOD_RSFT | MOD_RALT:
+                            keycode = RSFT(KC_RALT);
+                            break;
+                        case MOD_RALT:
+                            return true;
+                        default:
+                            caps_word_off();
+                            return true;
+                    }
+                } else {
+                    keycode = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+                }
+                break;
+            case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+                if (record->tap.count == 0) return true;
+                keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+                break;
+        }
+        clear_weak_mods();
+        if (TIMED(SIM_HOOK_CAPS_WORD_PRESS, caps_word_press_user(keycode))) {
+            send_keyboard_report();
+            return true;
+        }
+    }
+    caps_word_off();
+    return true;
+}
+
+static void caps_word_task(void) {
+    if (caps_word_active && timer_expired(timer_read(), caps_word_idle_timer)) caps_word_off();
+}
+
+// Leader (process_leader.c), with LEADER_PER_KEY_TIMING as configured.
+
+#define LEADER_SEQUENCE_SIZE 5
+
+static bool     leading;
+static uint16_t leader_time;
+static uint16_t leader_sequence[LEADER_SEQUENCE_SIZE];
+static uint8_t  leader_sequence_size;
+
+bool leader_sequence_active(void) {
+    return leading;
+}
+
+bool leader_sequence_timed_out(void) {
+    return timer_elapsed(leader_time) > LEADER_TIMEOUT;
+}
+
+static void leader_start(void) {
+    if (leading) return;
+    leader_start_user();
+    leading              = true;
+    leader_time          = timer_read();
+    leader_sequence_size = 0;
+    memset(leader_sequence, 0, sizeof(leader_sequence));
+}
+
+static void leader_end(void) {
+    leading = false;
+    TIMED_VOID(SIM_HOOK_LEADER_END, leader_end_user());
+}
+
+static bool process_leader(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed) return true;
+    if (leading && !leader_sequence_timed_out()) {
+        if (IS_QK_MOD_TAP(keycode)) {
+            keycode = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+        } else if (IS_QK_LAYER_TAP(keycode)) {
+            keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+        }
+        if (leader_sequence_size == LEADER_SEQUENCE_SIZE) {
+            // The buffer is full: end the sequence and process the key as usual.
+            leader_end();
+            return true;
+        }
+        leader_sequence[leader_sequence_size++] = keycode;
+        leader_time = timer_read();
+        return false;
+    }
+    if (keycode == QK_LEADER) leader_start();
+    return true;
+}
+
+bool leader_sequence_is(const uint16_t *keys, uint8_t count) {
+    if (count != leader_sequence_size) return false;
+    return !memcmp(leader_sequence, keys, count * sizeof(*keys));
+}
+
+static void leader_task(void) {
+    if (leading && leader_sequence_timed_out()) leader_end();
+}
+
+// Autocorrect (process_autocorrect.c), on the keymap's autocorrect_data.h.
+
+static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH];
+static uint8_t typo_buffer_size;
+
+bool autocorrect_is_enabled(void) {
+    return keymap_config.autocorrect_enable;
+}
+
+void autocorrect_toggle(void) {
+    keymap_config.autocorrect_enable = !keymap_config.autocorrect_enable;
+    typo_buffer_size                 = 0;
+}
+
+bool process_autocorrect_default_handler(uint16_t *keycode, keyrecord_t *record, uint8_t *typo_size, uint8_t *mods) {
+    switch (*keycode) {
+        case KC_LSFT:
+        case KC_RSFT:
+        case KC_CAPS:
+        case QK_TO ... QK_TO_MAX:
+        case QK_MOMENTARY ... QK_MOMENTARY_MAX:
+        case QK_DEF_LAYER ... QK_DEF_LAYER_MAX:
+        case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:
+        case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:
+        case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:
+        case QK_LAYER_MOD ... QK_LAYER_MOD_MAX:
+        case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:
+            return false;
+
+        // Shifted digits and punctuation are told apart from the plain ones.
+        case KC_1 ... KC_SLASH:
+            if (*mods & MOD_MASK_SHIFT) *keycode |= QK_LSFT;
+            break;
+
+        case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+            if (!record->tap.count) return false;
+            *keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(*keycode);
+            break;
+        case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+            if (!record->tap.count) return false;
+            *keycode = QK_MOD_TAP_GET_TAP_KEYCODE(*keycode);
+            break;
+
+        case QK_LSFT ... QK_LSFT + 255:
+        case QK_RSFT ... QK_RSFT + 255:
+            *mods |= *keycode >= QK_RSFT ? MOD_BIT(KC_RSFT) : MOD_BIT(KC_LSFT);
+            *keycode = QK_MODS_GET_BASIC_KEYCODE(*keycode);
+            return true;
+    }
+
+    // Only shift may be held, anything else starts the word over.
+    if ((*mods & ~MOD_MASK_SHIFT) != 0) {
+        *typo_size = 0;
+        return false;
+    }
+    return true;
+}
+
+static bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
+    uint8_t mods = get_mods() | get_oneshot_mods();
+
+    if (keycode >= QK_AUTOCORRECT_ON && keycode <= QK_AUTOCORRECT_TOGGLE) {
+        if (record->event.pressed) {
+            if (keycode == QK_AUTOCORRECT_ON) {
+                keymap_config.autocorrect_enable = true;
+            } else if (keycode == QK_AUTOCORRECT_OFF) {
+                keymap_config.autocorrect_enable = false;
+            } else {
+                autocorrect_toggle();
+            }
+        }
+        return false;
+    }
+    if (!keymap_config.autocorrect_enable) {
+        typo_buffer_size = 0;
+        return true;
+    }
+    if (!record->event.pressed) return true;
+
+    if (!TIMED(SIM_HOOK_AUTOCORRECT, process_autocorrect_user(&keycode, record, &typo_buffer_size, &mods))) return true;
+
+    switch (keycode) {
+        case KC_A ... KC_Z:
+            break;
+        case KC_1 ... KC_0:
+        case KC_TAB ... KC_SEMICOLON:
+        case KC_GRAVE ... KC_SLASH:
+            keycode = KC_SPC;
+            break;
+        case KC_ENTER:
+            typo_buffer_size = 0;
+            keycode          = KC_SPC;
+            break;
+        case KC_BACKSPACE:
+            if (typo_buffer_size > 0) typo_buffer_size--;
+            return true;
+        case KC_QUOTE:
+            if (mods & MOD_MASK_SHIFT) keycode = KC_SPC;
+            break;
+        default:
+            typo_buffer_size = 0;
+            return true;
+    }
+
+    if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
+        memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
+        typo_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
+    }
+    typo_buffer[typo_buffer_size++] = keycode;
+    if (typo_buffer_size < AUTOCORRECT_MIN_LENGTH) return true;
+
+    uint16_t state = 0;
+    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
+    for (int8_t i = typo_buffer_size - 1; i >= 0; i--) {
+        uint8_t key_i = typo_buffer[i];
+
+        if (code & 64) {
+            code &= 63;
+            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
+                if (!code) return true;
+            }
+            state = pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8;
+        } else if (code != key_i) {
+            return true;
+        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
+            ++state;
+        }
+        if (state >= DICTIONARY_SIZE) return true;
+
+        code = pgm_read_byte(autocorrect_data + state);
+        if (code & 128) {
+            uint8_t     backspaces = (code & 63) + !record->event.pressed;
+            const char *changes    = (const char *)(autocorrect_data + state + 1);
+            char        typo[AUTOCORRECT_MAX_LENGTH + 1] = {0};
+            char        correct[AUTOCORRECT_MAX_LENGTH + 1] = {0};
+
+            for (uint8_t k = 0; k < typo_buffer_size; k++) {
+                typo[k] = typo_buffer[k] == KC_SPC ? ' ' : 'a' + typo_buffer[k] - KC_A;
+            }
+            strncpy(correct, changes, AUTOCORRECT_MAX_LENGTH);
+            if (apply_autocorrect(backspaces, changes, typo, correct)) {
+                for (uint8_t k = 0; k < backspaces; k++) {
+                    tap_code(KC_BSPC);
+                }
+                send_string_P(changes);
+            }
+            if (keycode == KC_SPC) {
+                typo_buffer[0]   = KC_SPC;
+                typo_buffer_size = 1;
+                return true;
+            }
+            typo_buffer_size = 0;
+            return false;
+        }
+    }
+    return true;
+}
+
+// WPM (wpm.c), simplified: characters in the last five seconds, five per word.
+
+#define WPM_PERIODS 25
+#define WPM_PERIOD_MS 200
+
+static uint8_t  wpm_counts[WPM_PERIODS];
+static uint8_t  wpm_period;
+static uint16_t wpm_period_start;
+static uint8_t  current_wpm;
+
+uint8_t get_current_wpm(void) {
+    return current_wpm;
+}
+
+void set_current_wpm(uint8_t wpm) {
+    current_wpm = wpm;
+}
+
+static bool wpm_keycode(uint16_t keycode) {
+    if (IS_QK_MODS(keycode) || IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
+        keycode &= 0xFF;
+    } else if (keycode > 0xFF) {
+        keycode = 0;
+    }
+    return (keycode >= KC_A && keycode <= KC_0) || (keycode >= KC_TAB && keycode <= KC_SLASH);
+}
+
+static void update_wpm(uint16_t keycode) {
+    if (wpm_keycode(keycode)) {
+        if (wpm_counts[wpm_period] < UINT8_MAX) wpm_counts[wpm_period]++;
+    }
+#ifdef WPM_ALLOW_COUNT_REGRESSION
+    else if ((keycode == KC_BSPC || keycode == KC_DEL) && !(get_mods() & MOD_MASK_CTRL)) {
+        if (wpm_counts[wpm_period] > 0) wpm_counts[wpm_period]--;
+    }
+#endif
+}
+
+static void wpm_task(void) {
+    if (timer_elapsed(wpm_period_start) < WPM_PERIOD_MS) return;
+    wpm_period_start += WPM_PERIOD_MS;
+
+    uint16_t chars = 0;
+    for (uint8_t i = 0; i < WPM_PERIODS; i++) {
+        chars += wpm_counts[i];
+    }
+    current_wpm = MIN(chars * 12 / 5, UINT8_MAX);
+
+    wpm_period             = (wpm_period + 1) % WPM_PERIODS;
+    wpm_counts[wpm_period] = 0;
+}
+
+// Unicode (unicode.c), Linux and macOS input only.
+
+uint8_t sim_unicode_mode = UNICODE_MODE_LINUX;
+
+static led_t   unicode_saved_leds;
+static uint8_t unicode_saved_mods;
+
+uint8_t get_unicode_input_mode(void) {
+    return sim_unicode_mode;
+}
+
+static void unicode_input_start(void) {
+    unicode_saved_leds = host_keyboard_led_state();
+    // Caps Lock would shift Ctrl+Shift+U, so it is turned off first.
+    if (sim_unicode_mode == UNICODE_MODE_LINUX && unicode_saved_leds.caps_lock) tap_code(KC_CAPS_LOCK);
+    unicode_saved_mods = get_mods();
+    clear_mods();
+    clear_weak_mods();
+    if (sim_unicode_mode == UNICODE_MODE_LINUX) {
+        tap_code16(UNICODE_KEY_LNX);
+    } else {
+        register_code(KC_LALT);
+    }
+    wait_ms(UNICODE_TYPE_DELAY);
+}
+
+static void unicode_input_finish(void) {
+    if (sim_unicode_mode == UNICODE_MODE_LINUX) {
+        tap_code(KC_SPACE);
+        if (unicode_saved_leds.caps_lock) tap_code(KC_CAPS_LOCK);
+    } else {
+        unregister_code(KC_LALT);
+    }
+    set_mods(unicode_saved_mods);
+}
+
+static void register_hex32(uint32_t hex) {
+    bool first_digit = true;
+
+    for (int8_t i = 7; i >= 0; i--) {
+        uint8_t digit = (hex >> (i * 4)) & 0xF;
+        if (first_digit && (digit != 0 || i < 4)) first_digit = false;
+        if (first_digit) continue;
+        tap_code(digit == 0 ? KC_0 : digit < 10 ? KC_1 + digit - 1 : KC_A + digit - 10);
+    }
+}
+
+void register_unicode(uint32_t code_point) {
+    if (code_point > 0x10FFFF) return;
+    unicode_input_start();
+    register_hex32(code_point);
+    unicode_input_finish();
+}
+
+// Every code point through register_unicode(), ASCII included.
+void send_unicode_string(const char *str) {
+    while (*str) {
+        uint8_t  lead       = *str++;
+        uint8_t  extra      = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+        uint32_t code_point = extra ? lead & (0x3F >> extra) : lead;
+        for (; extra && (*str & 0xC0) == 0x80; extra--) {
+            code_point = code_point << 6 | (*str++ & 0x3F);
+        }
+        if (!extra) register_unicode(code_point);
+    }
+}
+
+#ifdef UNICODEMAP_ENABLE
+extern const uint32_t unicode_map[];
+
+uint16_t unicodemap_index(uint16_t keycode) {
+    if (IS_QK_UNICODEMAP_PAIR(keycode)) {
+        bool shift = (get_mods() | get_weak_mods() | get_oneshot_mods()) & MOD_MASK_SHIFT;
+        bool caps  = host_keyboard_led_state().caps_lock;
+        return (shift ^ caps) ? QK_UNICODEMAP_PAIR_GET_SHIFTED_INDEX(keycode) : QK_UNICODEMAP_PAIR_GET_UNSHIFTED_INDEX(keycode);
+    }
+    return QK_UNICODEMAP_GET_INDEX(keycode);
+}
+
+uint32_t unicodemap_get_code_point(uint16_t index) {
+    return pgm_read_dword(unicode_map + index);
+}
+
+void register_unicodemap(uint16_t index) {
+    register_unicode(unicodemap_get_code_point(index));
+}
+
+static bool process_unicodemap(uint16_t keycode, keyrecord_t *record) {
+    if (record->event.pressed && (IS_QK_UNICODEMAP(keycode) || IS_QK_UNICODEMAP_PAIR(keycode))) {
+        register_unicodemap(unicodemap_index(keycode));
+    }
+    return true;
+}
+#endif
+
+// Send string (send_string.c) on the keymap's sendstring LUTs.
+
+void send_char_with_delay(char ascii_code, uint8_t interval) {
+    uint8_t index   = (uint8_t)ascii_code & 0x7F;
+    uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[index]);
+    bool    shifted = PGM_LOADBIT(ascii_to_shift_lut, index);
+    bool    altgred = PGM_LOADBIT(ascii_to_altgr_lut, index);
+    bool    dead    = PGM_LOADBIT(ascii_to_dead_lut, index);
+
+    if (shifted) register_code(KC_LSFT);
+    if (altgred) register_code(KC_RALT);
+    tap_code_delay(keycode, interval);
+    if (altgred) unregister_code(KC_RALT);
+    if (shifted) unregister_code(KC_LSFT);
+    if (dead) tap_code(KC_SPACE);
+}
+
+void send_char(char ascii_code) {
+    send_char_with_delay(ascii_code, TAP_CODE_DELAY);
+}
+
+void send_string_with_delay(const char *string, uint8_t interval) {
+    for (; *string; string++) {
+        if (*string != SS_QMK_PREFIX) {
+            send_char_with_delay(*string, interval);
+            continue;
+        }
+        switch (*++string) {
+            case SS_TAP_CODE:
+                tap_code(*++string);
+                break;
+            case SS_DOWN_CODE:
+                register_code(*++string);
+                break;
+            case SS_UP_CODE:
+                unregister_code(*++string);
+                break;
+            case SS_DELAY_CODE: {
+                uint32_t ms = 0;
+                while (string[1] >= '0' && string[1] <= '9') {
+                    ms = ms * 10 + *++string - '0';
+                }
+                if (string[1] == '|') string++;
+                wait_ms(ms);
+                break;
+            }
+            default:
+                return;
+        }
+        wait_ms(interval);
+    }
+}
+
+void send_string(const char *string) {
+    send_string_with_delay(string, TAP_CODE_DELAY);
+}
+
+void send_string_P(const char *string) {
+    send_string(string);
+}
+
+// Tapping (action_tapping.c), reduced to what the keymap configures: tap-hold
+// keys wait up to their tapping term with later events buffered, a release
+// ends it as a tap, PERMISSIVE_HOLD holds on a nested tap, CHORDAL_HOLD taps
+// on a same-hand key, FLOW_TAP_TERM taps right away after a recent key.
+// Tap dance, retro tapping and hold-on-other-key-press are not modelled.
+
+#define WAITING_BUFFER_SIZE 8
+
+void (*sim_tap_hold_callback)(const sim_tap_hold_t *decision);
+
+static keyrecord_t tapping_key;
+static bool        tapping;
+static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE];
+static uint8_t     waiting_count;
+static uint16_t    flow_prev_keycode;
+static uint16_t    flow_prev_time;
+
+// Keys whose press was settled as a tap: their release carries tap.count.
+static keypos_t tapped_keys[8];
+static uint8_t  tapped_count;
+
+static bool is_tap_hold_keycode(uint16_t keycode) {
+    return IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode) || IS_QK_ONE_SHOT_MOD(keycode) || IS_QK_ONE_SHOT_LAYER(keycode);
+}
+
+static void mark_tapped(keypos_t key) {
+    if (tapped_count < ARRAY_SIZE(tapped_keys)) tapped_keys[tapped_count++] = key;
+}
+
+static bool take_tapped(keypos_t key) {
+    for (uint8_t i = 0; i < tapped_count; i++) {
+        if (KEYEQ(tapped_keys[i], key)) {
+            tapped_keys[i] = tapped_keys[--tapped_count];
+            return true;
+        }
+    }
+    return false;
+}
+
+static void report_decision(const keyrecord_t *record, uint16_t keycode, bool tap, bool flow, bool chord) {
+    if (!sim_tap_hold_callback) return;
+    sim_tap_hold_t decision = {
+        .keycode     = keycode,
+        .key         = record->event.key,
+        .pressed     = timer_read32() - TIMER_DIFF_16(timer_read(), record->event.time),
+        .settled     = timer_read32(),
+        .tap         = tap,
+        .flow_tap    = flow,
+        .chord_tap   = chord,
+        .interrupted = record->tap.interrupted,
+    };
+    sim_tap_hold_callback(&decision);
+}
+
+// Ends the wait for the tap-hold key and replays what was buffered behind it.
+static void settle(bool tap, bool chord) {
+    keyrecord_t key = tapping_key;
+    keyrecord_t buffered[WAITING_BUFFER_SIZE];
+    uint8_t     count = waiting_count;
+    uint16_t    keycode = get_record_keycode(&key, false);
+
+    memcpy(buffered, waiting_buffer, sizeof(buffered));
+    tapping       = false;
+    waiting_count = 0;
+
+    key.tap.count       = tap ? 1 : 0;
+    key.tap.interrupted = count > 0;
+    if (tap) mark_tapped(key.event.key);
+    report_decision(&key, keycode, tap, false, chord);
+    flow_prev_keycode = keycode;
+    flow_prev_time    = key.event.time;
+    process_record(&key);
+
+    for (uint8_t i = 0; i < count; i++) {
+        process_record_tapping(&buffered[i]);
+    }
+}
+
+static bool in_waiting_buffer(keypos_t key) {
+    for (uint8_t i = 0; i < waiting_count; i++) {
+        if (KEYEQ(waiting_buffer[i].event.key, key)) return true;
+    }
+    return false;
+}
+
+// Same-hand presses tap a mod-tap or layer-tap, unless the other key is a
+// tap-hold key too, so same-hand mod chords keep working.
+static bool chordal_tap(const keyrecord_t *other) {
+#ifdef CHORDAL_HOLD
+    uint16_t keycode = get_record_keycode(&tapping_key, false);
+    if (!IS_QK_MOD_TAP(keycode) && !IS_QK_LAYER_TAP(keycode)) return false;
+    if (other->event.key.row >= MATRIX_ROWS) return false;
+
+    keyrecord_t copy          = *other;
+    uint16_t    other_keycode = get_record_keycode(&copy, false);
+    if (is_tap_hold_keycode(other_keycode)) return false;
+
+    return !get_chordal_hold(keycode, &tapping_key, other_keycode, &copy);
+#else
+    return false;
+#endif
+}
+
+static void process_release(keyrecord_t *record) {
+    if (take_tapped(record->event.key)) record->tap.count = 1;
+    process_record(record);
+}
+
+static void process_record_tapping(keyrecord_t *record) {
+    if (tapping) {
+        uint16_t now    = IS_NOEVENT(record->event) ? timer_read() : record->event.time;
+        uint16_t term   = TIMED(SIM_HOOK_TAPPING_TERM, get_tapping_term(get_record_keycode(&tapping_key, false), &tapping_key));
+        bool     within = TIMER_DIFF_16(now, tapping_key.event.time) < term;
+
+        if (!within) {
+            settle(false, false);
+            process_record_tapping(record);
+            return;
+        }
+        if (IS_NOEVENT(record->event)) return;
+
+        if (KEYEQ(record->event.key, tapping_key.event.key) && !record->event.pressed) {
+            settle(true, false);
+            process_record_tapping(record);
+            return;
+        }
+        if (record->event.pressed) {
+            if (chordal_tap(record)) {
+                settle(true, true);
+                process_record_tapping(record);
+            } else if (waiting_count < WAITING_BUFFER_SIZE) {
+                waiting_buffer[waiting_count++] = *record;
+            } else {
+                settle(false, false);
+                process_record_tapping(record);
+            }
+            return;
+        }
+        if (in_waiting_buffer(record->event.key)) {
+#ifdef PERMISSIVE_HOLD
+            settle(false, false);
+            process_record_tapping(record);
+#else
+            waiting_buffer[waiting_count++] = *record;
+#endif
+            return;
+        }
+        // A key pressed before the tap-hold key goes out right away.
+        process_release(record);
+        return;
+    }
+
+    if (IS_NOEVENT(record->event)) return;
+    if (!record->event.pressed) {
+        process_release(record);
+        return;
+    }
+
+    uint16_t keycode = get_record_keycode(record, false);
+    if (is_tap_hold_keycode(keycode)) {
+        uint16_t flow_term = 0;
+        if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) flow_term = get_flow_tap_term(keycode, record, flow_prev_keycode);
+        if (flow_term && TIMER_DIFF_16(record->event.time, flow_prev_time) < flow_term) {
+            record->tap.count = 1;
+            mark_tapped(record->event.key);
+            report_decision(record, keycode, true, true, false);
+            flow_prev_keycode = keycode;
+            flow_prev_time    = record->event.time;
+            process_record(record);
+            return;
+        }
+        tapping_key   = *record;
+        tapping       = true;
+        waiting_count = 0;
+        return;
+    }
+    flow_prev_keycode = keycode;
+    flow_prev_time    = record->event.time;
+    process_record(record);
+}
+
+void action_tapping_process(keyrecord_t record) {
+    key_depth++;
+    process_record_tapping(&record);
+    key_depth--;
+}
+
+// Key processing (action.c, quantum.c)
+
+static bool process_layer_lock(uint16_t keycode, keyrecord_t *record) {
+    if (keycode != QK_LAYER_LOCK) return true;
+    if (record->event.pressed) layer_lock_invert(get_highest_layer(layer_state | default_layer_state));
+    return false;
+}
+
+static bool process_record_quantum(uint16_t keycode, keyrecord_t *record) {
+    if (record->event.pressed) update_wpm(keycode);
+    if (!process_caps_word(keycode, record)) return false;
+    if (!TIMED(SIM_HOOK_PROCESS_RECORD, process_record_user(keycode, record))) return false;
+#ifdef UNICODEMAP_ENABLE
+    if (!process_unicodemap(keycode, record)) return false;
+#endif
+    if (!process_leader(keycode, record)) return false;
+    if (!process_autocorrect(keycode, record)) return false;
+    if (!process_layer_lock(keycode, record)) return false;
+
+    if (record->event.pressed) {
+        switch (keycode) {
+            case QK_BOOTLOADER:
+            case QK_REBOOT:
+                fprintf(stderr, "sim: %s requested, ignored\n", keycode == QK_BOOTLOADER ? "bootloader" : "reboot");
+                return false;
+            case QK_CLEAR_EEPROM:
+                eeconfig_init_user_datablock();
+                return false;
+        }
+    }
+    return true;
+}
+
+// Whether a press uses up the one-shot layer, as in QMK's process_action():
+// modifiers, held mod-taps and one-shot mods don't.
+static bool consumes_oneshot_layer(uint16_t keycode, keyrecord_t *record) {
+    if (IS_MODIFIER_KEYCODE(keycode) || IS_QK_ONE_SHOT_MOD(keycode) || IS_QK_ONE_SHOT_LAYER(keycode)) return false;
+    if (IS_QK_MOD_TAP(keycode) && record->tap.count == 0) return false;
+    return true;
+}
+
+static void process_action(uint16_t keycode, keyrecord_t *record) {
+    bool    pressed         = record->event.pressed;
+    bool    release_oneshot = false;
+    uint8_t mods;
+
+    if (oneshot_layer_active && pressed && consumes_oneshot_layer(keycode, record)) {
+        oneshot_layer_other_key();
+        release_oneshot = !oneshot_layer_active;
+    }
+
+    if (keycode <= QK_BASIC_MAX) {
+        if (pressed) {
+            register_code(keycode);
+        } else {
+            unregister_code(keycode);
+        }
+    } else if (IS_QK_MODS(keycode)) {
+        uint8_t key = QK_MODS_GET_BASIC_KEYCODE(keycode);
+        bool    mod = IS_MODIFIER_KEYCODE(key) || key == KC_NO;
+        mods        = mod_config_8bit(QK_MODS_GET_MODS(keycode));
+        if (pressed) {
+            if (mod) {
+                add_mods(mods);
+            } else {
+                add_weak_mods(mods);
+            }
+            send_keyboard_report();
+            register_code(key);
+        } else {
+            unregister_code(key);
+            if (mod) {
+                del_mods(mods);
+            } else {
+                del_weak_mods(mods);
+            }
+            send_keyboard_report();
+        }
+    } else if (IS_QK_MOD_TAP(keycode)) {
+        mods = mod_config_8bit(QK_MOD_TAP_GET_MODS(keycode));
+        if (record->tap.count > 0) {
+            if (pressed) {
+                register_code(QK_MOD_TAP_GET_TAP_KEYCODE(keycode));
+            } else {
+                unregister_code(QK_MOD_TAP_GET_TAP_KEYCODE(keycode));
+            }
+        } else if (pressed) {
+            register_mods(mods);
+        } else {
+            unregister_mods(mods);
+        }
+    } else if (IS_QK_LAYER_TAP(keycode)) {
+        if (record->tap.count > 0) {
+            if (pressed) {
+                register_code(QK_LAYER_TAP_GET_TAP_KEYCODE(keycode));
+            } else {
+                unregister_code(QK_LAYER_TAP_GET_TAP_KEYCODE(keycode));
+            }
+        } else if (pressed) {
+            layer_on(QK_LAYER_TAP_GET_LAYER(keycode));
+        } else {
+            layer_off(QK_LAYER_TAP_GET_LAYER(keycode));
+        }
+    } else if (IS_QK_MOMENTARY(keycode)) {
+        uint8_t layer = QK_MOMENTARY_GET_LAYER(keycode);
+        if (pressed) {
+            layer_on(layer);
+        } else if (!is_layer_locked(layer)) {
+            layer_off(layer);
+        }
+    } else if (IS_QK_TOGGLE_LAYER(keycode)) {
+        if (!pressed) layer_invert(QK_TOGGLE_LAYER_GET_LAYER(keycode));
+    } else if (IS_QK_DEF_LAYER(keycode)) {
+        if (pressed) default_layer_set((layer_state_t)1 << QK_DEF_LAYER_GET_LAYER(keycode));
+    } else if (IS_QK_TO(keycode)) {
+        if (pressed) layer_move(QK_TO_GET_LAYER(keycode));
+    } else if (IS_QK_ONE_SHOT_MOD(keycode)) {
+        mods = mod_config_8bit(QK_ONE_SHOT_MOD_GET_MODS(keycode));
+        if (pressed) {
+            if (record->tap.count == 0) {
+                register_mods(mods | get_oneshot_mods());
+            } else {
+                add_oneshot_mods(mods);
+            }
+        } else if (record->tap.count == 0) {
+            clear_oneshot_mods();
+            unregister_mods(mods);
+        }
+    } else if (IS_QK_ONE_SHOT_LAYER(keycode)) {
+        uint8_t layer = QK_ONE_SHOT_LAYER_GET_LAYER(keycode);
+        if (pressed) {
+            set_oneshot_layer(layer);
+        } else {
+            oneshot_layer_held = false;
+            if (oneshot_layer_used || record->tap.count == 0) clear_oneshot_layer();
+        }
+    }
+
+    // The release of a key that used up the one-shot layer would otherwise be
+    // looked up without it, so it is sent right away with the layer back on.
+    if (release_oneshot && !oneshot_layer_held) {
+        record->event.pressed = false;
+        layer_on(oneshot_layer);
+        process_record(record);
+        layer_off(oneshot_layer);
+    }
+}
+
+void process_record(keyrecord_t *record) {
+    if (IS_NOEVENT(record->event)) return;
+    key_depth++;
+
+    uint16_t keycode = get_record_keycode(record, true);
+    record->keycode  = keycode;
+    if (!process_record_quantum(keycode, record)) {
+        if (oneshot_layer_active && record->event.pressed && consumes_oneshot_layer(keycode, record)) oneshot_layer_other_key();
+        key_depth--;
+        return;
+    }
+    process_action(keycode, record);
+    TIMED_VOID(SIM_HOOK_POST_PROCESS_RECORD, post_process_record_user(keycode, record));
+    key_depth--;
+}
+
+void action_exec(keyevent_t event) {
+    if (has_oneshot_mods_timed_out()) clear_oneshot_mods();
+    if (ONESHOT_TIMEOUT > 0 && oneshot_layer_active && !oneshot_layer_held && timer_elapsed(oneshot_layer_time) >= ONESHOT_TIMEOUT) clear_oneshot_layer();
+
+    keyrecord_t record = {.event = event};
+    if (!IS_NOEVENT(event)) {
+        key_depth++;
+        uint16_t keycode = get_record_keycode(&record, false);
+        bool     go      = TIMED(SIM_HOOK_PRE_PROCESS_RECORD, pre_process_record_user(keycode, &record));
+        key_depth--;
+        if (!go) return;
+    }
+    action_tapping_process(record);
+}
+
+// Matrix and main loop (keyboard.c)
+
+static matrix_row_t matrix[MATRIX_ROWS];
+static matrix_row_t matrix_previous[MATRIX_ROWS];
+static uint32_t     last_input_activity;
+static uint32_t     last_matrix_activity;
+static uint32_t     scan_count;
+static uint32_t     scan_rate;
+static uint32_t     scan_rate_timer;
+
+// Debounce on the raw state matrix_set_raw() sets, a copy of the QMK file
+// DEBOUNCE_TYPE in ../rules.mk names (the Makefile passes it on).
+
+bool                sim_debounce = true;
+static bool         raw_used;
+static bool         raw_changed;
+static matrix_row_t raw_matrix[MATRIX_ROWS];
+
+void matrix_set_raw(uint8_t row, uint8_t col, bool pressed) {
+    matrix_row_t next = pressed ? raw_matrix[row] | (matrix_row_t)1 << col : raw_matrix[row] & ~((matrix_row_t)1 << col);
+    raw_changed |= next != raw_matrix[row];
+    raw_matrix[row] = next;
+    raw_used        = true;
+}
+
+#if defined(SIM_DEBOUNCE_asym_eager_defer_pk)
+// debounce/asym_eager_defer_pk.c: a press goes to the matrix on the scan that
+// sees it and the key is ignored for DEBOUNCE ms, a release once it has been
+// stable for DEBOUNCE ms. One scan per ms, so the elapsed time is always 1.
+
+#    define DEBOUNCE_ELAPSED 0
+
+typedef struct {
+    bool    pressed;
+    uint8_t time;
+} debounce_counter_t;
+
+static debounce_counter_t debounce_counters[MATRIX_ROWS][MATRIX_COLS];
+static bool               counters_need_update;
+static bool               matrix_need_update;
+
+static void update_debounce_counters_and_transfer_if_expired(void) {
+    counters_need_update = false;
+    matrix_need_update   = false;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            debounce_counter_t *counter = &debounce_counters[row][col];
+            matrix_row_t        mask    = (matrix_row_t)1 << col;
+            if (counter->time == DEBOUNCE_ELAPSED) continue;
+            if (counter->time <= 1) {
+                counter->time = DEBOUNCE_ELAPSED;
+                if (counter->pressed) {
+                    // Key down, eager: already in the matrix, look again for
+                    // changes made while it was ignored.
+                    matrix_need_update = true;
+                } else {
+                    // Key up, deferred: stable long enough.
+                    matrix[row] = (matrix[row] & ~mask) | (raw_matrix[row] & mask);
+                }
+            } else {
+                counter->time--;
+                counters_need_update = true;
+            }
+        }
+    }
+}
+
+static void transfer_matrix_values(void) {
+    matrix_need_update = false;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t delta = raw_matrix[row] ^ matrix[row];
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            debounce_counter_t *counter = &debounce_counters[row][col];
+            matrix_row_t        mask    = (matrix_row_t)1 << col;
+            if (delta & mask) {
+                if (counter->time == DEBOUNCE_ELAPSED) {
+                    counter->pressed     = raw_matrix[row] & mask;
+                    counter->time        = DEBOUNCE;
+                    counters_need_update = true;
+                    if (counter->pressed) matrix[row] ^= mask;
+                }
+            } else if (counter->time != DEBOUNCE_ELAPSED && !counter->pressed) {
+                // Bounced back while a release was pending: start over.
+                counter->time = DEBOUNCE;
+            }
+        }
+    }
+}
+
+static void debounce(void) {
+    if (counters_need_update) update_debounce_counters_and_transfer_if_expired();
+    if (raw_changed || matrix_need_update) transfer_matrix_values();
+    raw_changed = false;
+}
+
+#elif defined(SIM_DEBOUNCE_sym_defer_g)
+// debounce/sym_defer_g.c, QMK's default: once no switch has changed for
+// DEBOUNCE ms, the whole matrix is copied over.
+
+static bool     debouncing;
+static uint16_t debouncing_time;
+
+static void debounce(void) {
+    if (raw_changed) {
+        debouncing      = true;
+        debouncing_time = timer_read();
+    } else if (debouncing && timer_elapsed(debouncing_time) >= DEBOUNCE) {
+        memcpy(matrix, raw_matrix, sizeof(matrix));
+        debouncing = false;
+    }
+    raw_changed = false;
+}
+
+#else
+#    error "no copy of this DEBOUNCE_TYPE in the stand-in core"
+#endif
+
+void matrix_set_key(uint8_t row, uint8_t col, bool pressed) {
+    if (pressed) {
+        matrix[row] |= (matrix_row_t)1 << col;
+    } else {
+        matrix[row] &= ~((matrix_row_t)1 << col);
+    }
+}
+
+matrix_row_t matrix_get_row(uint8_t row) {
+    return matrix[row];
+}
+
+uint32_t last_input_activity_elapsed(void) {
+    return timer_elapsed32(last_input_activity);
+}
+
+uint32_t last_matrix_activity_elapsed(void) {
+    return timer_elapsed32(last_matrix_activity);
+}
+
+uint32_t get_matrix_scan_rate(void) {
+    return scan_rate;
+}
+
+static void oled_task(void);
+
+void keyboard_init(void) {
+    memset(matrix, 0, sizeof(matrix));
+    memset(matrix_previous, 0, sizeof(matrix_previous));
+    last_input_activity = last_matrix_activity = scan_rate_timer = timer_read32();
+    wpm_period_start                                            = timer_read();
+    default_layer_state                                         = 1;
+    oled_init_user(OLED_ROTATION_0);
+    keyboard_post_init_user();
+}
+
+void keyboard_task(void) {
+    if (++scan_count, timer_elapsed32(scan_rate_timer) >= 1000) {
+        scan_rate       = scan_count;
+        scan_count      = 0;
+        scan_rate_timer = timer_read32();
+    }
+    if (raw_used && !sim_debounce) {
+        memcpy(matrix, raw_matrix, sizeof(matrix));
+    } else if (raw_used) {
+        debounce();
+    }
+    TIMED_VOID(SIM_HOOK_MATRIX_SCAN, matrix_scan_user());
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t changes = matrix[row] ^ matrix_previous[row];
+        for (uint8_t col = 0; changes && col < MATRIX_COLS; col++) {
+            matrix_row_t mask = (matrix_row_t)1 << col;
+            if (!(changes & mask)) continue;
+            changes &= ~mask;
+            matrix_previous[row] ^= mask;
+            last_input_activity = last_matrix_activity = timer_read32();
+            action_exec(MAKE_KEYEVENT(row, col, (matrix[row] & mask) != 0));
+        }
+    }
+    action_exec((keyevent_t){.type = TICK_EVENT, .time = timer_read()});
+
+    leader_task();
+    caps_word_task();
+    wpm_task();
+    oled_task();
+    TIMED_VOID(SIM_HOOK_HOUSEKEEPING, housekeeping_task_user());
+}
+
+void suspend_power_down(void) {
+    suspend_power_down_user();
+}
+
+void suspend_wakeup_init(void) {
+    clear_keyboard();
+    suspend_wakeup_init_user();
+}
+
+// Split transport (transactions.c)
+
+sim_split_t sim_split = {.master = true};
+
+typedef void (*rpc_handler_t)(uint8_t, const void *, uint8_t, void *);
+static rpc_handler_t rpc_handlers[8];
+
+bool is_keyboard_master(void) {
+    return sim_split.master;
+}
+
+bool is_keyboard_left(void) {
+    return true;
+}
+
+void transaction_register_rpc(int8_t transaction_id, rpc_handler_t callback) {
+    if (transaction_id >= 0 && transaction_id < (int8_t)ARRAY_SIZE(rpc_handlers)) rpc_handlers[transaction_id] = callback;
+}
+
+// Bytes on the wire as transaction_rpc_exec() sends them over the serial
+// link: the RPC info, the request buffer, the call and the response buffer,
+// each a transaction of its own with an id byte and its handshake. Both
+// buffers go whole, whatever `size` is.
+bool transaction_rpc_send(int8_t transaction_id, uint8_t size, const void *buffer) {
+    if (size > RPC_M2S_BUFFER_SIZE) return false;
+    sim_split.messages++;
+    sim_split.bytes += 4 * 2 + 4 + RPC_M2S_BUFFER_SIZE + RPC_S2M_BUFFER_SIZE;
+    if (sim_split.loopback && rpc_handlers[transaction_id]) {
+        sim_split.master = false;
+        rpc_handlers[transaction_id](size, buffer, 0, NULL);
+        sim_split.master = true;
+    }
+    return true;
+}
+
+// Persistent storage: the user datablock in RAM, with its writes counted.
+// Like QMK's wear leveling driver, an update writes its whole span once any
+// byte of it differs. As in eeconfig.c the block is valid while its stored
+// version word matches EECONFIG_USER_DATA_VERSION; an invalid block reads as
+// zeros and the next update marks it valid. The version word's own writes are
+// not counted.
+
+sim_flash_t     sim_flash = {.budget = -1};
+static uint8_t  datablock[EECONFIG_USER_DATA_SIZE + 1];
+static uint32_t datablock_version;
+
+uint8_t *sim_datablock(void) {
+    return datablock;
+}
+
+bool eeconfig_is_user_datablock_valid(void) {
+    return datablock_version == (EECONFIG_USER_DATA_VERSION);
+}
+
+void eeconfig_init_user_datablock(void) {
+    datablock_version = EECONFIG_USER_DATA_VERSION;
+    memset(datablock, 0, EECONFIG_USER_DATA_SIZE);
+    sim_flash.writes++;
+    sim_flash.bytes += EECONFIG_USER_DATA_SIZE;
+}
+
+void eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t length) {
+    if (offset + length > EECONFIG_USER_DATA_SIZE) abort();
+    if (!eeconfig_is_user_datablock_valid()) {
+        memset(data, 0, length);
+        return;
+    }
+    memcpy(data, datablock + offset, length);
+}
+
+void eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t length) {
+    if (offset + length > EECONFIG_USER_DATA_SIZE) abort();
+    datablock_version = EECONFIG_USER_DATA_VERSION;
+    if (memcmp(datablock + offset, data, length) == 0) return;
+    if (sim_flash.budget == 0) {
+        memcpy(datablock + offset, data, MIN(sim_flash.tear, length));
+        sim_flash.tear = 0;
+        return;
+    }
+    if (sim_flash.budget > 0) sim_flash.budget--;
+
+    memcpy(datablock + offset, data, length);
+    sim_flash.writes++;
+    sim_flash.bytes += length;
+    if (key_depth) {
+        sim_flash.writes_in_keys++;
+        sim_flash.bytes_in_keys += length;
+    }
+}
+
+// OLED (oled_driver.c): the buffer, QMK's cursor rules and a character grid
+// instead of a font. Glyphs are a made-up pattern, blank for a space.
+
+sim_oled_t     sim_oled;
+static uint8_t oled_buffer[OLED_MATRIX_SIZE];
+static char    oled_text[OLED_MAX_LINES][OLED_MAX_CHARS];
+static uint16_t oled_cursor;
+static bool    oled_active = true;
+static uint8_t oled_brightness = 255;
+
+const uint8_t *sim_oled_buffer(void) {
+    return oled_buffer;
+}
+
+char sim_oled_char(uint8_t col, uint8_t line) {
+    return oled_text[line][col];
+}
+
+static void oled_set_byte(uint16_t index, uint8_t value) {
+    if (oled_buffer[index] == value) return;
+    oled_buffer[index] = value;
+    sim_oled.bytes_changed++;
+}
+
+void oled_clear(void) {
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i++) {
+        oled_set_byte(i, 0);
+    }
+    memset(oled_text, ' ', sizeof(oled_text));
+    oled_cursor = 0;
+}
+
+void oled_set_cursor(uint8_t col, uint8_t line) {
+    uint16_t index = line * OLED_DISPLAY_WIDTH + col * OLED_FONT_WIDTH;
+    oled_cursor    = index >= OLED_MATRIX_SIZE ? 0 : index;
+}
+
+static void oled_advance_page(bool clear_remaining) {
+    uint16_t index     = oled_cursor;
+    uint16_t remaining = OLED_DISPLAY_WIDTH - index % OLED_DISPLAY_WIDTH;
+
+    if (clear_remaining) {
+        for (uint16_t i = 0; i < remaining; i++) {
+            oled_set_byte(index + i, 0);
+        }
+        for (uint8_t col = (index % OLED_DISPLAY_WIDTH) / OLED_FONT_WIDTH; col < OLED_MAX_CHARS; col++) {
+            oled_text[index / OLED_DISPLAY_WIDTH][col] = ' ';
+        }
+    }
+    index += remaining;
+    oled_cursor = index >= OLED_MATRIX_SIZE ? 0 : index;
+}
+
+void oled_write_char(const char data, bool invert) {
+    if (data == '\n') {
+        oled_advance_page(true);
+        return;
+    }
+    uint16_t index = oled_cursor;
+    for (uint8_t i = 0; i < OLED_FONT_WIDTH; i++) {
+        uint8_t glyph = data == ' ' || i == OLED_FONT_WIDTH - 1 ? 0 : (uint8_t)(data * (i + 3) + i);
+        oled_set_byte(index + i, invert ? ~glyph : glyph);
+    }
+    if (index % OLED_DISPLAY_WIDTH % OLED_FONT_WIDTH == 0 && index % OLED_DISPLAY_WIDTH / OLED_FONT_WIDTH < OLED_MAX_CHARS) {
+        oled_text[index / OLED_DISPLAY_WIDTH][index % OLED_DISPLAY_WIDTH / OLED_FONT_WIDTH] = data;
+    }
+    sim_oled.chars_written++;
+
+    oled_cursor += OLED_FONT_WIDTH;
+    if (oled_cursor % OLED_DISPLAY_WIDTH > OLED_DISPLAY_WIDTH - OLED_FONT_WIDTH) {
+        oled_advance_page(false);
+    } else if (oled_cursor >= OLED_MATRIX_SIZE) {
+        oled_cursor = 0;
+    }
+}
+
+void oled_write(const char *data, bool invert) {
+    while (*data) {
+        oled_write_char(*data++, invert);
+    }
+}
+
+void oled_write_P(const char *data, bool invert) {
+    oled_write(data, invert);
+}
+
+void oled_write_raw_byte(const char data, uint16_t index) {
+    if (index >= OLED_MATRIX_SIZE) return;
+    oled_set_byte(index, (uint8_t)data);
+    oled_text[index / OLED_DISPLAY_WIDTH][index % OLED_DISPLAY_WIDTH / OLED_FONT_WIDTH % OLED_MAX_CHARS] = '\0';
+}
+
+void oled_write_raw_P(const char *data, uint16_t size) {
+    for (uint16_t i = 0; i < size && i < OLED_MATRIX_SIZE; i++) {
+        oled_write_raw_byte(data[i], i);
+    }
+}
+
+bool oled_on(void) {
+    oled_active = true;
+    return true;
+}
+
+bool oled_off(void) {
+    oled_active = false;
+    return false;
+}
+
+bool is_oled_on(void) {
+    return oled_active;
+}
+
+uint8_t oled_set_brightness(uint8_t level) {
+    oled_brightness = level;
+    return level;
+}
+
+uint8_t oled_get_brightness(void) {
+    return oled_brightness;
+}
+
+static void oled_task(void) {
+#ifdef OLED_ENABLE
+    TIMED(SIM_HOOK_OLED_TASK, oled_task_user());
+#endif
+}
+
+// Raw HID and console
+
+uint8_t  sim_raw_hid_answer[RAW_EPSIZE];
+uint32_t sim_raw_hid_answers;
+bool     sim_console;
+
+void raw_hid_send(uint8_t *data, uint8_t length) {
+    memcpy(sim_raw_hid_answer, data, MIN(length, RAW_EPSIZE));
+    sim_raw_hid_answers++;
+}
+
+int uprintf(const char *fmt, ...) {
+    if (!sim_console) return 0;
+    va_list args;
+    va_start(args, fmt);
+    int written = vfprintf(stderr, fmt, args);
+    va_end(args);
+    return written;
+}
+
+const char *get_u16_str(uint16_t curr_num, char curr_pad) {
+    static char buf[6];
+    uint8_t     i = 5;
+
+    buf[5] = '\0';
+    do {
+        buf[--i] = '0' + curr_num % 10;
+        curr_num /= 10;
+    } while (curr_num && i > 0);
+    while (i > 0) {
+        buf[--i] = curr_pad;
+    }
+    return buf;
+}
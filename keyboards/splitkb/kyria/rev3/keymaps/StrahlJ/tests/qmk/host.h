@@ -0,0 +1,7 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Declared in quantum.h for the host build.
+#include "quantum.h"
@@ -0,0 +1,84 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// The DE_* keycodes of QMK's keymap_german.h that the keymap uses.
+#include "quantum.h"
+
+#define DE_Q KC_Q
+#define DE_W KC_W
+#define DE_E KC_E
+#define DE_R KC_R
+#define DE_T KC_T
+#define DE_Z KC_Y
+#define DE_U KC_U
+#define DE_I KC_I
+#define DE_O KC_O
+#define DE_P KC_P
+#define DE_A KC_A
+#define DE_S KC_S
+#define DE_D KC_D
+#define DE_F KC_F
+#define DE_G KC_G
+#define DE_H KC_H
+#define DE_J KC_J
+#define DE_K KC_K
+#define DE_L KC_L
+#define DE_Y KC_Z
+#define DE_X KC_X
+#define DE_C KC_C
+#define DE_V KC_V
+#define DE_B KC_B
+#define DE_N KC_N
+#define DE_M KC_M
+#define DE_1 KC_1
+#define DE_2 KC_2
+#define DE_3 KC_3
+#define DE_4 KC_4
+#define DE_5 KC_5
+#define DE_6 KC_6
+#define DE_7 KC_7
+#define DE_8 KC_8
+#define DE_9 KC_9
+#define DE_0 KC_0
+#define DE_SS KC_MINS
+#define DE_ACUT KC_EQL
+#define DE_UDIA KC_LBRC
+#define DE_PLUS KC_RBRC
+#define DE_ODIA KC_SCLN
+#define DE_ADIA KC_QUOT
+#define DE_HASH KC_NUHS
+#define DE_CIRC KC_GRV
+#define DE_COMM KC_COMM
+#define DE_DOT KC_DOT
+#define DE_MINS KC_SLSH
+#define DE_LABK KC_NUBS
+#define DE_DEG S(DE_CIRC)
+#define DE_EXLM S(DE_1)
+#define DE_DQUO S(DE_2)
+#define DE_SECT S(DE_3)
+#define DE_DLR S(DE_4)
+#define DE_PERC S(DE_5)
+#define DE_AMPR S(DE_6)
+#define DE_SLSH S(DE_7)
+#define DE_LPRN S(DE_8)
+#define DE_RPRN S(DE_9)
+#define DE_EQL S(DE_0)
+#define DE_QUES S(DE_SS)
+#define DE_GRV S(DE_ACUT)
+#define DE_ASTR S(DE_PLUS)
+#define DE_QUOT S(DE_HASH)
+#define DE_RABK S(DE_LABK)
+#define DE_SCLN S(DE_COMM)
+#define DE_COLN S(DE_DOT)
+#define DE_UNDS S(DE_MINS)
+#define DE_EURO ALGR(DE_E)
+#define DE_LCBR ALGR(DE_7)
+#define DE_LBRC ALGR(DE_8)
+#define DE_RBRC ALGR(DE_9)
+#define DE_RCBR ALGR(DE_0)
+#define DE_BSLS ALGR(DE_SS)
+#define DE_AT ALGR(DE_Q)
+#define DE_TILD ALGR(DE_PLUS)
+#define DE_PIPE ALGR(DE_LABK)
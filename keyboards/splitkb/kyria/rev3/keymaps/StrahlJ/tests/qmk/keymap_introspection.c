@@ -0,0 +1,21 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// As in QMK, keymap.c is compiled as part of this file, so the size of
+// keymaps[] is known here.
+
+#include "../../keymap.c"
+
+uint8_t keymap_layer_count(void) {
+    return ARRAY_SIZE(keymaps);
+}
+
+uint32_t sim_keymap_reads;
+
+uint16_t keycode_at_keymap_location(uint8_t layer, uint8_t row, uint8_t col) {
+    if (layer < keymap_layer_count() && row < MATRIX_ROWS && col < MATRIX_COLS) {
+        sim_keymap_reads++;
+        return pgm_read_word(&keymaps[layer][row][col]);
+    }
+    return KC_TRNS;
+}
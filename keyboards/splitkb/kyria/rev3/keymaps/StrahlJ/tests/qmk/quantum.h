@@ -0,0 +1,640 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Host stand-in for the parts of QMK the keymap uses, so keymap.c and its
+// modules build unchanged and run against core.c. Keycode values, report
+// layouts and function signatures follow QMK; only what the keymap touches is
+// declared. This is not QMK: see core.c for what is modelled and how closely.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+
+// Matrix size of the keyboard, from its keyboard.json as in QMK, see the
+// Makefile.
+#include "info_config.h"
+#define MAX_LAYER 16
+
+#define PROGMEM
+#define PSTR(x) x
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+#ifndef MIN
+#    define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef MAX
+#    define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+// Basic keycodes (HID usage page 7) and QMK's system/consumer aliases.
+// clang-format off
+enum qk_keycodes {
+    KC_NO = 0x00, KC_TRANSPARENT = 0x01,
+    KC_A = 0x04, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J, KC_K, KC_L, KC_M,
+    KC_N, KC_O, KC_P, KC_Q, KC_R, KC_S, KC_T, KC_U, KC_V, KC_W, KC_X, KC_Y, KC_Z,
+    KC_1, KC_2, KC_3, KC_4, KC_5, KC_6, KC_7, KC_8, KC_9, KC_0,
+    KC_ENTER, KC_ESCAPE, KC_BACKSPACE, KC_TAB, KC_SPACE, KC_MINUS, KC_EQUAL, KC_LEFT_BRACKET,
+    KC_RIGHT_BRACKET, KC_BACKSLASH, KC_NONUS_HASH, KC_SEMICOLON, KC_QUOTE, KC_GRAVE, KC_COMMA,
+    KC_DOT, KC_SLASH, KC_CAPS_LOCK,
+    KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6, KC_F7, KC_F8, KC_F9, KC_F10, KC_F11, KC_F12,
+    KC_PRINT_SCREEN, KC_SCROLL_LOCK, KC_PAUSE, KC_INSERT, KC_HOME, KC_PAGE_UP, KC_DELETE, KC_END,
+    KC_PAGE_DOWN, KC_RIGHT, KC_LEFT, KC_DOWN, KC_UP, KC_NUM_LOCK,
+    KC_NONUS_BACKSLASH = 0x64, KC_APPLICATION,
+    KC_SYSTEM_POWER = 0xA5, KC_SYSTEM_SLEEP, KC_SYSTEM_WAKE,
+    KC_AUDIO_MUTE, KC_AUDIO_VOL_UP, KC_AUDIO_VOL_DOWN, KC_MEDIA_NEXT_TRACK, KC_MEDIA_PREV_TRACK,
+    KC_MEDIA_STOP, KC_MEDIA_PLAY_PAUSE, KC_MEDIA_SELECT, KC_MEDIA_EJECT, KC_MAIL, KC_CALCULATOR,
+    KC_MY_COMPUTER, KC_WWW_SEARCH, KC_WWW_HOME, KC_WWW_BACK, KC_WWW_FORWARD, KC_WWW_STOP,
+    KC_WWW_REFRESH, KC_WWW_FAVORITES, KC_MEDIA_FAST_FORWARD, KC_MEDIA_REWIND,
+    KC_BRIGHTNESS_UP, KC_BRIGHTNESS_DOWN,
+    MS_UP = 0xCD, MS_DOWN, MS_LEFT, MS_RGHT, MS_BTN1, MS_BTN2, MS_BTN3, MS_BTN4, MS_BTN5, MS_BTN6,
+    MS_BTN7, MS_BTN8, MS_WHLU, MS_WHLD, MS_WHLL, MS_WHLR, MS_ACL0, MS_ACL1, MS_ACL2,
+    KC_LEFT_CTRL = 0xE0, KC_LEFT_SHIFT, KC_LEFT_ALT, KC_LEFT_GUI,
+    KC_RIGHT_CTRL, KC_RIGHT_SHIFT, KC_RIGHT_ALT, KC_RIGHT_GUI,
+};
+// clang-format on
+
+#define KC_TRNS KC_TRANSPARENT
+#define _______ KC_TRNS
+#define XXXXXXX KC_NO
+#define KC_ENT KC_ENTER
+#define KC_ESC KC_ESCAPE
+#define KC_BSPC KC_BACKSPACE
+#define KC_SPC KC_SPACE
+#define KC_MINS KC_MINUS
+#define KC_EQL KC_EQUAL
+#define KC_LBRC KC_LEFT_BRACKET
+#define KC_RBRC KC_RIGHT_BRACKET
+#define KC_BSLS KC_BACKSLASH
+#define KC_NUHS KC_NONUS_HASH
+#define KC_SCLN KC_SEMICOLON
+#define KC_QUOT KC_QUOTE
+#define KC_GRV KC_GRAVE
+#define KC_COMM KC_COMMA
+#define KC_SLSH KC_SLASH
+#define KC_CAPS KC_CAPS_LOCK
+#define KC_PSCR KC_PRINT_SCREEN
+#define KC_SCRL KC_SCROLL_LOCK
+#define KC_PAUS KC_PAUSE
+#define KC_INS KC_INSERT
+#define KC_PGUP KC_PAGE_UP
+#define KC_DEL KC_DELETE
+#define KC_PGDN KC_PAGE_DOWN
+#define KC_RGHT KC_RIGHT
+#define KC_NUM KC_NUM_LOCK
+#define KC_NUBS KC_NONUS_BACKSLASH
+#define KC_APP KC_APPLICATION
+#define KC_PWR KC_SYSTEM_POWER
+#define KC_MUTE KC_AUDIO_MUTE
+#define KC_VOLU KC_AUDIO_VOL_UP
+#define KC_VOLD KC_AUDIO_VOL_DOWN
+#define KC_MNXT KC_MEDIA_NEXT_TRACK
+#define KC_MPRV KC_MEDIA_PREV_TRACK
+#define KC_MSTP KC_MEDIA_STOP
+#define KC_MPLY KC_MEDIA_PLAY_PAUSE
+#define KC_WBAK KC_WWW_BACK
+#define KC_WFWD KC_WWW_FORWARD
+#define KC_WREF KC_WWW_REFRESH
+#define KC_BRIU KC_BRIGHTNESS_UP
+#define KC_BRID KC_BRIGHTNESS_DOWN
+#define KC_LCTL KC_LEFT_CTRL
+#define KC_LSFT KC_LEFT_SHIFT
+#define KC_LALT KC_LEFT_ALT
+#define KC_LGUI KC_LEFT_GUI
+#define KC_RCTL KC_RIGHT_CTRL
+#define KC_RSFT KC_RIGHT_SHIFT
+#define KC_RALT KC_RIGHT_ALT
+#define KC_RGUI KC_RIGHT_GUI
+
+#define QK_BASIC 0x0000
+#define QK_BASIC_MAX 0x00FF
+#define IS_BASIC_KEYCODE(code) ((code) >= KC_A && (code) <= 0xA4)
+#define IS_SYSTEM_KEYCODE(code) ((code) >= KC_SYSTEM_POWER && (code) <= KC_SYSTEM_WAKE)
+#define IS_CONSUMER_KEYCODE(code) ((code) >= KC_AUDIO_MUTE && (code) <= KC_BRIGHTNESS_DOWN)
+#define IS_MOUSE_KEYCODE(code) ((code) >= MS_UP && (code) <= MS_ACL2)
+#define IS_MODIFIER_KEYCODE(code) ((code) >= KC_LEFT_CTRL && (code) <= KC_RIGHT_GUI)
+
+// Modifiers: 8-bit masks in reports, 5-bit with a right-hand flag in keycodes.
+#define MOD_BIT(code) (1 << ((code) & 0x07))
+#define MOD_LCTL 0x01
+#define MOD_LSFT 0x02
+#define MOD_LALT 0x04
+#define MOD_LGUI 0x08
+#define MOD_RCTL 0x11
+#define MOD_RSFT 0x12
+#define MOD_RALT 0x14
+#define MOD_RGUI 0x18
+#define MOD_MASK_CTRL (MOD_BIT(KC_LCTL) | MOD_BIT(KC_RCTL))
+#define MOD_MASK_SHIFT (MOD_BIT(KC_LSFT) | MOD_BIT(KC_RSFT))
+#define MOD_MASK_ALT (MOD_BIT(KC_LALT) | MOD_BIT(KC_RALT))
+#define MOD_MASK_GUI (MOD_BIT(KC_LGUI) | MOD_BIT(KC_RGUI))
+#define MOD_MASK_CS (MOD_MASK_CTRL | MOD_MASK_SHIFT)
+#define MOD_MASK_CG (MOD_MASK_CTRL | MOD_MASK_GUI)
+
+// Quantum keycode ranges.
+#define QK_MODS 0x0100
+#define QK_MODS_MAX 0x1FFF
+#define QK_LCTL 0x0100
+#define QK_LSFT 0x0200
+#define QK_LALT 0x0400
+#define QK_LGUI 0x0800
+#define QK_RMODS_MIN 0x1000
+#define QK_RCTL 0x1100
+#define QK_RSFT 0x1200
+#define QK_RALT 0x1400
+#define QK_RGUI 0x1800
+#define QK_MOD_TAP 0x2000
+#define QK_MOD_TAP_MAX 0x3FFF
+#define QK_LAYER_TAP 0x4000
+#define QK_LAYER_TAP_MAX 0x4FFF
+#define QK_LAYER_MOD 0x5000
+#define QK_LAYER_MOD_MAX 0x51FF
+#define QK_TO 0x5200
+#define QK_TO_MAX 0x521F
+#define QK_MOMENTARY 0x5220
+#define QK_MOMENTARY_MAX 0x523F
+#define QK_DEF_LAYER 0x5240
+#define QK_DEF_LAYER_MAX 0x525F
+#define QK_TOGGLE_LAYER 0x5260
+#define QK_TOGGLE_LAYER_MAX 0x527F
+#define QK_ONE_SHOT_LAYER 0x5280
+#define QK_ONE_SHOT_LAYER_MAX 0x529F
+#define QK_ONE_SHOT_MOD 0x52A0
+#define QK_ONE_SHOT_MOD_MAX 0x52BF
+#define QK_LAYER_TAP_TOGGLE 0x52C0
+#define QK_LAYER_TAP_TOGGLE_MAX 0x52DF
+#define QK_QUANTUM 0x7C00
+#define QK_QUANTUM_MAX 0x7DFF
+#define QK_KB 0x7E00
+#define QK_USER 0x7E40
+#define QK_UNICODEMAP 0x8000
+#define QK_UNICODEMAP_MAX 0xBFFF
+#define QK_UNICODEMAP_PAIR 0xC000
+#define QK_UNICODEMAP_PAIR_MAX 0xFFFF
+
+enum qk_quantum_keycodes {
+    QK_BOOTLOADER = 0x7C00,
+    QK_REBOOT,
+    QK_DEBUG_TOGGLE,
+    QK_CLEAR_EEPROM,
+    QK_DYNAMIC_MACRO_RECORD_START_1 = 0x7C53,
+    QK_DYNAMIC_MACRO_RECORD_START_2,
+    QK_DYNAMIC_MACRO_RECORD_STOP,
+    QK_DYNAMIC_MACRO_PLAY_1,
+    QK_DYNAMIC_MACRO_PLAY_2,
+    QK_LEADER,
+    QK_CAPS_WORD_TOGGLE = 0x7C73,
+    QK_AUTOCORRECT_ON,
+    QK_AUTOCORRECT_OFF,
+    QK_AUTOCORRECT_TOGGLE,
+    QK_LAYER_LOCK = 0x7C7B,
+};
+
+#define SAFE_RANGE QK_USER
+
+#define QK_BOOT QK_BOOTLOADER
+#define QK_RBT QK_REBOOT
+#define EE_CLR QK_CLEAR_EEPROM
+#define DM_REC1 QK_DYNAMIC_MACRO_RECORD_START_1
+#define DM_REC2 QK_DYNAMIC_MACRO_RECORD_START_2
+#define DM_RSTP QK_DYNAMIC_MACRO_RECORD_STOP
+#define DM_PLY1 QK_DYNAMIC_MACRO_PLAY_1
+#define DM_PLY2 QK_DYNAMIC_MACRO_PLAY_2
+#define QK_LEAD QK_LEADER
+#define CW_TOGG QK_CAPS_WORD_TOGGLE
+#define AC_TOGG QK_AUTOCORRECT_TOGGLE
+#define QK_LLCK QK_LAYER_LOCK
+
+#define LCTL(kc) (QK_LCTL | (kc))
+#define LSFT(kc) (QK_LSFT | (kc))
+#define LALT(kc) (QK_LALT | (kc))
+#define LGUI(kc) (QK_LGUI | (kc))
+#define RCTL(kc) (QK_RCTL | (kc))
+#define RSFT(kc) (QK_RSFT | (kc))
+#define RALT(kc) (QK_RALT | (kc))
+#define RGUI(kc) (QK_RGUI | (kc))
+#define S(kc) LSFT(kc)
+#define ALGR(kc) RALT(kc)
+
+#define MT(mod, kc) (QK_MOD_TAP | (((mod) & 0x1F) << 8) | ((kc) & 0xFF))
+#define LT(layer, kc) (QK_LAYER_TAP | (((layer) & 0xF) << 8) | ((kc) & 0xFF))
+#define TO(layer) (QK_TO | ((layer) & 0x1F))
+#define MO(layer) (QK_MOMENTARY | ((layer) & 0x1F))
+#define DF(layer) (QK_DEF_LAYER | ((layer) & 0x1F))
+#define TG(layer) (QK_TOGGLE_LAYER | ((layer) & 0x1F))
+#define OSL(layer) (QK_ONE_SHOT_LAYER | ((layer) & 0x1F))
+#define OSM(mod) (QK_ONE_SHOT_MOD | ((mod) & 0x1F))
+#define UM(i) (QK_UNICODEMAP | ((i) & 0x3FFF))
+#define UP(i, j) (QK_UNICODEMAP_PAIR | ((i) & 0x7F) | (((j) & 0x7F) << 7))
+
+#define IS_QK_MODS(code) ((code) >= QK_MODS && (code) <= QK_MODS_MAX)
+#define IS_QK_MOD_TAP(code) ((code) >= QK_MOD_TAP && (code) <= QK_MOD_TAP_MAX)
+#define IS_QK_LAYER_TAP(code) ((code) >= QK_LAYER_TAP && (code) <= QK_LAYER_TAP_MAX)
+#define IS_QK_TO(code) ((code) >= QK_TO && (code) <= QK_TO_MAX)
+#define IS_QK_MOMENTARY(code) ((code) >= QK_MOMENTARY && (code) <= QK_MOMENTARY_MAX)
+#define IS_QK_DEF_LAYER(code) ((code) >= QK_DEF_LAYER && (code) <= QK_DEF_LAYER_MAX)
+#define IS_QK_TOGGLE_LAYER(code) ((code) >= QK_TOGGLE_LAYER && (code) <= QK_TOGGLE_LAYER_MAX)
+#define IS_QK_ONE_SHOT_LAYER(code) ((code) >= QK_ONE_SHOT_LAYER && (code) <= QK_ONE_SHOT_LAYER_MAX)
+#define IS_QK_ONE_SHOT_MOD(code) ((code) >= QK_ONE_SHOT_MOD && (code) <= QK_ONE_SHOT_MOD_MAX)
+#define IS_QK_UNICODEMAP(code) ((code) >= QK_UNICODEMAP && (code) <= QK_UNICODEMAP_MAX)
+#define IS_QK_UNICODEMAP_PAIR(code) ((uint16_t)(code) >= QK_UNICODEMAP_PAIR)
+
+#define QK_MODS_GET_MODS(kc) (((kc) >> 8) & 0x1F)
+#define QK_MODS_GET_BASIC_KEYCODE(kc) ((kc) & 0xFF)
+#define QK_MOD_TAP_GET_MODS(kc) (((kc) >> 8) & 0x1F)
+#define QK_MOD_TAP_GET_TAP_KEYCODE(kc) ((kc) & 0xFF)
+#define QK_LAYER_TAP_GET_LAYER(kc) (((kc) >> 8) & 0xF)
+#define QK_LAYER_TAP_GET_TAP_KEYCODE(kc) ((kc) & 0xFF)
+#define QK_ONE_SHOT_MOD_GET_MODS(kc) ((kc) & 0x1F)
+#define QK_ONE_SHOT_LAYER_GET_LAYER(kc) ((kc) & 0x1F)
+#define QK_MOMENTARY_GET_LAYER(kc) ((kc) & 0x1F)
+#define QK_TOGGLE_LAYER_GET_LAYER(kc) ((kc) & 0x1F)
+#define QK_DEF_LAYER_GET_LAYER(kc) ((kc) & 0x1F)
+#define QK_TO_GET_LAYER(kc) ((kc) & 0x1F)
+#define QK_UNICODEMAP_GET_INDEX(kc) ((kc) & 0x3FFF)
+#define QK_UNICODEMAP_PAIR_GET_UNSHIFTED_INDEX(kc) ((kc) & 0x7F)
+#define QK_UNICODEMAP_PAIR_GET_SHIFTED_INDEX(kc) (((kc) >> 7) & 0x7F)
+
+// Key events.
+typedef struct {
+    uint8_t col;
+    uint8_t row;
+} keypos_t;
+
+typedef enum {
+    TICK_EVENT = 0,
+    KEY_EVENT,
+    ENCODER_CW_EVENT,
+    ENCODER_CCW_EVENT,
+    COMBO_EVENT,
+    DIP_SWITCH_ON_EVENT,
+    DIP_SWITCH_OFF_EVENT,
+} keyevent_type_t;
+
+typedef struct {
+    keypos_t        key;
+    uint16_t        time;
+    keyevent_type_t type;
+    bool            pressed;
+} keyevent_t;
+
+typedef struct {
+    bool    interrupted : 1;
+    bool    reserved2 : 1;
+    bool    reserved1 : 1;
+    bool    reserved0 : 1;
+    uint8_t count : 4;
+} tap_t;
+
+typedef struct {
+    keyevent_t event;
+    tap_t      tap;
+    uint16_t   keycode;
+} keyrecord_t;
+
+// Rows QMK uses for events that don't come from the matrix.
+#define KEYLOC_DIP_SWITCH_OFF 250
+#define KEYLOC_DIP_SWITCH_ON 251
+#define KEYLOC_ENCODER_CCW 252
+#define KEYLOC_ENCODER_CW 253
+#define KEYLOC_COMBO 254
+#define KEYLOC_TICK 255
+
+#define MAKE_KEYPOS(row_num, col_num) ((keypos_t){.row = (row_num), .col = (col_num)})
+#define MAKE_KEYEVENT(row_num, col_num, press) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .type = KEY_EVENT})
+#define KEYEQ(keya, keyb) ((keya).row == (keyb).row && (keya).col == (keyb).col)
+#define IS_NOEVENT(event) ((event).type == TICK_EVENT)
+
+typedef uint32_t matrix_row_t;
+
+// Layers.
+typedef uint16_t layer_state_t;
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+
+void          layer_state_set(layer_state_t state);
+bool          layer_state_is(uint8_t layer);
+bool          layer_state_cmp(layer_state_t state, uint8_t layer);
+void          layer_on(uint8_t layer);
+void          layer_off(uint8_t layer);
+void          layer_invert(uint8_t layer);
+void          layer_move(uint8_t layer);
+void          layer_clear(void);
+void          default_layer_set(layer_state_t state);
+uint8_t       get_highest_layer(layer_state_t state);
+uint8_t       layer_switch_get_layer(keypos_t key);
+uint16_t      keymap_key_to_keycode(uint8_t layer, keypos_t key);
+bool          is_layer_locked(uint8_t layer);
+layer_state_t layer_state_set_user(layer_state_t state);
+layer_state_t default_layer_state_set_user(layer_state_t state);
+
+// Modifiers and the keyboard report.
+uint8_t get_mods(void);
+void    add_mods(uint8_t mods);
+void    del_mods(uint8_t mods);
+void    set_mods(uint8_t mods);
+void    clear_mods(void);
+void    register_mods(uint8_t mods);
+void    unregister_mods(uint8_t mods);
+uint8_t get_weak_mods(void);
+void    add_weak_mods(uint8_t mods);
+void    del_weak_mods(uint8_t mods);
+void    set_weak_mods(uint8_t mods);
+void    clear_weak_mods(void);
+void    register_weak_mods(uint8_t mods);
+void    unregister_weak_mods(uint8_t mods);
+uint8_t get_oneshot_mods(void);
+void    add_oneshot_mods(uint8_t mods);
+void    del_oneshot_mods(uint8_t mods);
+void    set_oneshot_mods(uint8_t mods);
+void    clear_oneshot_mods(void);
+uint8_t get_oneshot_locked_mods(void);
+
+void add_key(uint8_t key);
+void del_key(uint8_t key);
+void clear_keys(void);
+bool has_anykey(void);
+void send_keyboard_report(void);
+void clear_keyboard(void);
+void clear_keyboard_but_mods(void);
+
+void register_code(uint8_t code);
+void unregister_code(uint8_t code);
+void tap_code(uint8_t code);
+void tap_code_delay(uint8_t code, uint16_t delay);
+void register_code16(uint16_t code);
+void unregister_code16(uint16_t code);
+void tap_code16(uint16_t code);
+
+#ifndef TAP_CODE_DELAY
+#    define TAP_CODE_DELAY 0
+#endif
+
+// Key processing.
+void     action_exec(keyevent_t event);
+void     action_tapping_process(keyrecord_t record);
+void     process_record(keyrecord_t *record);
+uint16_t get_record_keycode(keyrecord_t *record, bool update_layer_cache);
+uint16_t keycode_at_keymap_location(uint8_t layer, uint8_t row, uint8_t col);
+uint8_t  keymap_layer_count(void);
+
+bool     pre_process_record_user(uint16_t keycode, keyrecord_t *record);
+bool     process_record_user(uint16_t keycode, keyrecord_t *record);
+void     post_process_record_user(uint16_t keycode, keyrecord_t *record);
+void     keyboard_post_init_user(void);
+void     matrix_scan_user(void);
+void     housekeeping_task_user(void);
+void     suspend_power_down_user(void);
+void     suspend_wakeup_init_user(void);
+uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record);
+uint16_t get_flow_tap_term(uint16_t keycode, keyrecord_t *record, uint16_t prev_keycode);
+bool     is_flow_tap_key(uint16_t keycode);
+char     chordal_hold_handedness(keypos_t key);
+bool     get_chordal_hold(uint16_t tap_hold_keycode, keyrecord_t *tap_hold_record, uint16_t other_keycode, keyrecord_t *other_record);
+bool     get_chordal_hold_default(keyrecord_t *tap_hold_record, keyrecord_t *other_record);
+
+#ifndef TAPPING_TERM
+#    define TAPPING_TERM 200
+#endif
+
+// Timer and waits, on the simulation's virtual clock.
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+uint16_t timer_elapsed(uint16_t last);
+uint32_t timer_elapsed32(uint32_t last);
+void     wait_ms(uint32_t ms);
+void     wait_us(uint32_t us);
+
+#define TIMER_DIFF_16(a, b) ((uint16_t)((a) - (b)))
+#define TIMER_DIFF_32(a, b) ((uint32_t)((a) - (b)))
+#define timer_expired(current, future) ((uint16_t)((current) - (future)) < UINT16_C(0x8000))
+#define timer_expired32(current, future) ((uint32_t)((current) - (future)) < UINT32_C(0x80000000))
+
+// Split keyboard. The RPC buffers are sent whole on every call, as in
+// transport.h.
+#ifndef RPC_M2S_BUFFER_SIZE
+#    define RPC_M2S_BUFFER_SIZE 32
+#endif
+#ifndef RPC_S2M_BUFFER_SIZE
+#    define RPC_S2M_BUFFER_SIZE 32
+#endif
+
+bool is_keyboard_master(void);
+bool is_keyboard_left(void);
+bool transaction_rpc_send(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer);
+void transaction_register_rpc(int8_t transaction_id, void (*callback)(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer));
+
+#ifdef SPLIT_TRANSACTION_IDS_USER
+enum { SPLIT_TRANSACTION_IDS_USER };
+#endif
+
+// Activity, LEDs, WPM.
+typedef union {
+    uint8_t raw;
+    struct {
+        bool    num_lock : 1;
+        bool    caps_lock : 1;
+        bool    scroll_lock : 1;
+        bool    compose : 1;
+        bool    kana : 1;
+        uint8_t reserved : 3;
+    };
+} led_t;
+
+led_t        host_keyboard_led_state(void);
+uint32_t     last_input_activity_elapsed(void);
+uint32_t     last_matrix_activity_elapsed(void);
+matrix_row_t matrix_get_row(uint8_t row);
+uint32_t     get_matrix_scan_rate(void);
+uint8_t      get_current_wpm(void);
+void         set_current_wpm(uint8_t wpm);
+
+// Caps word, leader and autocorrect.
+bool is_caps_word_on(void);
+void caps_word_on(void);
+void caps_word_off(void);
+bool caps_word_press_user(uint16_t keycode);
+
+void leader_start_user(void);
+void leader_end_user(void);
+bool leader_sequence_active(void);
+bool leader_sequence_timed_out(void);
+// What leader_sequence_one_key() to leader_sequence_five_keys() test: whether
+// the buffer holds exactly these keys.
+bool leader_sequence_is(const uint16_t *keys, uint8_t count);
+
+bool autocorrect_is_enabled(void);
+void autocorrect_toggle(void);
+bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct);
+bool process_autocorrect_user(uint16_t *keycode, keyrecord_t *record, uint8_t *typo_buffer_size, uint8_t *mods);
+bool process_autocorrect_default_handler(uint16_t *keycode, keyrecord_t *record, uint8_t *typo_buffer_size, uint8_t *mods);
+
+// Unicode.
+#define UNICODE_MODE_MACOS 0
+#define UNICODE_MODE_LINUX 1
+#define UNICODE_MODE_WINDOWS 2
+#define UNICODE_MODE_BSD 3
+#define UNICODE_MODE_WINCOMPOSE 4
+#ifndef UNICODE_KEY_LNX
+#    define UNICODE_KEY_LNX LCTL(LSFT(KC_U))
+#endif
+#ifndef UNICODE_TYPE_DELAY
+#    define UNICODE_TYPE_DELAY 10
+#endif
+
+uint8_t  get_unicode_input_mode(void);
+void     register_unicode(uint32_t code_point);
+void     send_unicode_string(const char *str);
+void     register_unicodemap(uint16_t index);
+uint16_t unicodemap_index(uint16_t keycode);
+uint32_t unicodemap_get_code_point(uint16_t index);
+
+// Send string.
+#define SS_QMK_PREFIX 1
+#define SS_TAP_CODE 1
+#define SS_DOWN_CODE 2
+#define SS_UP_CODE 3
+#define SS_DELAY_CODE 4
+
+extern const uint8_t ascii_to_shift_lut[16];
+extern const uint8_t ascii_to_altgr_lut[16];
+extern const uint8_t ascii_to_dead_lut[16];
+extern const uint8_t ascii_to_keycode_lut[128];
+
+void send_string(const char *string);
+void send_string_P(const char *string);
+void send_string_with_delay(const char *string, uint8_t interval);
+void send_char(char ascii_code);
+void send_char_with_delay(char ascii_code, uint8_t interval);
+
+#define SEND_STRING(string) send_string_P(PSTR(string))
+
+// Host reports and driver.
+#define KEYBOARD_REPORT_KEYS 6
+#define NKRO_REPORT_BITS 30
+#define REPORT_ID_SYSTEM 3
+#define REPORT_ID_CONSUMER 4
+
+typedef struct {
+    uint8_t mods;
+    uint8_t reserved;
+    uint8_t keys[KEYBOARD_REPORT_KEYS];
+} report_keyboard_t;
+
+typedef struct {
+    uint8_t report_id;
+    uint8_t mods;
+    uint8_t bits[NKRO_REPORT_BITS];
+} report_nkro_t;
+
+typedef struct {
+    uint8_t buttons;
+    int8_t  x;
+    int8_t  y;
+    int8_t  v;
+    int8_t  h;
+} report_mouse_t;
+
+typedef struct {
+    uint8_t  report_id;
+    uint16_t usage;
+} report_extra_t;
+
+typedef struct {
+    uint8_t (*keyboard_leds)(void);
+    void (*send_keyboard)(report_keyboard_t *);
+    void (*send_nkro)(report_nkro_t *);
+    void (*send_mouse)(report_mouse_t *);
+    void (*send_extra)(report_extra_t *);
+} host_driver_t;
+
+host_driver_t *host_get_driver(void);
+void           host_set_driver(host_driver_t *driver);
+void           host_keyboard_send(report_keyboard_t *report);
+void           host_nkro_send(report_nkro_t *report);
+void           host_mouse_send(report_mouse_t *report);
+void           host_system_send(uint16_t usage);
+void           host_consumer_send(uint16_t usage);
+
+typedef union {
+    uint16_t raw;
+    struct {
+        bool swap_control_capslock : 1;
+        bool capslock_to_control : 1;
+        bool swap_lalt_lgui : 1;
+        bool swap_ralt_rgui : 1;
+        bool no_gui : 1;
+        bool swap_grave_esc : 1;
+        bool swap_backslash_backspace : 1;
+        bool nkro : 1;
+        bool swap_lctl_lgui : 1;
+        bool swap_rctl_rgui : 1;
+        bool oneshot_enable : 1;
+        bool swap_escape_capslock : 1;
+        bool autocorrect_enable : 1;
+    };
+} keymap_config_t;
+
+extern keymap_config_t keymap_config;
+
+// Persistent storage, a RAM image of the user datablock.
+bool eeconfig_is_user_datablock_valid(void);
+void eeconfig_init_user_datablock(void);
+void eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t length);
+void eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t length);
+
+// OLED, a 128x64 buffer with QMK's 6x8 character grid.
+#define OLED_DISPLAY_WIDTH 128
+#define OLED_DISPLAY_HEIGHT 64
+#define OLED_MATRIX_SIZE (OLED_DISPLAY_HEIGHT / 8 * OLED_DISPLAY_WIDTH)
+#define OLED_FONT_WIDTH 6
+#define OLED_FONT_HEIGHT 8
+#define OLED_MAX_CHARS (OLED_DISPLAY_WIDTH / OLED_FONT_WIDTH)
+#define OLED_MAX_LINES (OLED_DISPLAY_HEIGHT / OLED_FONT_HEIGHT)
+
+typedef enum {
+    OLED_ROTATION_0   = 0,
+    OLED_ROTATION_90  = 1,
+    OLED_ROTATION_180 = 2,
+    OLED_ROTATION_270 = 3,
+} oled_rotation_t;
+
+oled_rotation_t oled_init_user(oled_rotation_t rotation);
+bool            oled_task_user(void);
+void            oled_clear(void);
+void            oled_set_cursor(uint8_t col, uint8_t line);
+void            oled_write_char(const char data, bool invert);
+void            oled_write(const char *data, bool invert);
+void            oled_write_P(const char *data, bool invert);
+void            oled_write_raw_byte(const char data, uint16_t index);
+void            oled_write_raw_P(const char *data, uint16_t size);
+bool            oled_on(void);
+bool            oled_off(void);
+bool            is_oled_on(void);
+uint8_t         oled_set_brightness(uint8_t level);
+uint8_t         oled_get_brightness(void);
+
+// Raw HID and console.
+#define RAW_EPSIZE 32
+void raw_hid_send(uint8_t *data, uint8_t length);
+void raw_hid_receive(uint8_t *data, uint8_t length);
+
+int uprintf(const char *fmt, ...);
+#ifdef CONSOLE_ENABLE
+#    define dprintf(...) uprintf(__VA_ARGS__)
+#else
+#    define dprintf(...) \
+        do {             \
+        } while (0)
+#endif
+
+const char *get_u16_str(uint16_t curr_num, char curr_pad);
@@ -0,0 +1,11 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Matrix size of the Kyria rev3, four rows by seven columns per half, as in
+// keyboards/splitkb/kyria/rev3/keyboard.json. Used when the keymap is built
+// outside a qmk_firmware checkout; otherwise layout.py writes this file and
+// kyria.h from keyboard.json into build/layout, see the Makefile.
+#define MATRIX_ROWS 8
+#define MATRIX_COLS 7
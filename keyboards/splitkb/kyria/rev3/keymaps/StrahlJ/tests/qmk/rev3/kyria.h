@@ -0,0 +1,29 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// QMK_KEYBOARD_H for the host build, with the LAYOUT of the rev3 keyboard.json:
+// rows 0-3 are the left half and rows 4-7 the right one, column 0 is the
+// inner one, it carries the two inner keys of the bottom row. Traces from
+// tools/keylog_dump.py use the same positions. Used when the keymap is built
+// outside a qmk_firmware checkout, see info_config.h.
+#include "quantum.h"
+
+// clang-format off
+#define LAYOUT( \
+    L00, L01, L02, L03, L04, L05,                     R06, R07, R08, R09, R10, R11, \
+    L12, L13, L14, L15, L16, L17,                     R18, R19, R20, R21, R22, R23, \
+    L24, L25, L26, L27, L28, L29, L30, L31, R32, R33, R34, R35, R36, R37, R38, R39, \
+                   L40, L41, L42, L43, L44, R45, R46, R47, R48, R49 \
+) { \
+    { KC_NO, L05, L04, L03, L02, L01, L00 }, \
+    { KC_NO, L17, L16, L15, L14, L13, L12 }, \
+    { L30,   L29, L28, L27, L26, L25, L24 }, \
+    { L31,   L44, L43, L42, L41, L40, KC_NO }, \
+    { KC_NO, R06, R07, R08, R09, R10, R11 }, \
+    { KC_NO, R18, R19, R20, R21, R22, R23 }, \
+    { R33,   R34, R35, R36, R37, R38, R39 }, \
+    { R32,   R45, R46, R47, R48, R49, KC_NO } \
+}
+// clang-format on
@@ -0,0 +1,91 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// QMK's sendstring LUTs for a German host layout: the key, and whether Shift,
+// AltGr or a following space (dead keys) are needed, per ASCII character.
+#include "quantum.h"
+
+#ifndef KCLUT_ENTRY
+#    define KCLUT_ENTRY(a, b, c, d, e, f, g, h) \
+        (((a) ? 1 : 0) << 0 | ((b) ? 1 : 0) << 1 | ((c) ? 1 : 0) << 2 | ((d) ? 1 : 0) << 3 | ((e) ? 1 : 0) << 4 | ((f) ? 1 : 0) << 5 | ((g) ? 1 : 0) << 6 | ((h) ? 1 : 0) << 7)
+#endif
+
+// clang-format off
+const uint8_t ascii_to_shift_lut[16] PROGMEM = {
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 1, 1, 0, 1, 1, 1, 1),
+    KCLUT_ENTRY(1, 1, 1, 0, 0, 0, 0, 1),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 1, 1, 0, 1, 1, 1),
+    KCLUT_ENTRY(0, 1, 1, 1, 1, 1, 1, 1),
+    KCLUT_ENTRY(1, 1, 1, 1, 1, 1, 1, 1),
+    KCLUT_ENTRY(1, 1, 1, 1, 1, 1, 1, 1),
+    KCLUT_ENTRY(1, 1, 1, 0, 0, 0, 0, 1),
+    KCLUT_ENTRY(1, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+};
+
+const uint8_t ascii_to_altgr_lut[16] PROGMEM = {
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(1, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 1, 1, 1, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 1, 1, 1, 1, 0),
+};
+
+const uint8_t ascii_to_dead_lut[16] PROGMEM = {
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 1, 0),
+    KCLUT_ENTRY(1, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+    KCLUT_ENTRY(0, 0, 0, 0, 0, 0, 0, 0),
+};
+
+const uint8_t ascii_to_keycode_lut[128] PROGMEM = {
+    XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX,
+    KC_BSPC, KC_TAB , KC_ENT , XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX,
+    XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX,
+    XXXXXXX, XXXXXXX, XXXXXXX, KC_ESC , XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX,
+    KC_SPC , KC_1   , KC_2   , KC_NUHS, KC_4   , KC_5   , KC_6   , KC_NUHS,
+    KC_8   , KC_9   , KC_RBRC, KC_RBRC, KC_COMM, KC_SLSH, KC_DOT , KC_7,
+    KC_0   , KC_1   , KC_2   , KC_3   , KC_4   , KC_5   , KC_6   , KC_7,
+    KC_8   , KC_9   , KC_DOT , KC_COMM, KC_NUBS, KC_0   , KC_NUBS, KC_MINS,
+    KC_Q   , KC_A   , KC_B   , KC_C   , KC_D   , KC_E   , KC_F   , KC_G,
+    KC_H   , KC_I   , KC_J   , KC_K   , KC_L   , KC_M   , KC_N   , KC_O,
+    KC_P   , KC_Q   , KC_R   , KC_S   , KC_T   , KC_U   , KC_V   , KC_W,
+    KC_X   , KC_Z   , KC_Y   , KC_8   , KC_MINS, KC_9   , KC_GRV , KC_SLSH,
+    KC_EQL , KC_A   , KC_B   , KC_C   , KC_D   , KC_E   , KC_F   , KC_G,
+    KC_H   , KC_I   , KC_J   , KC_K   , KC_L   , KC_M   , KC_N   , KC_O,
+    KC_P   , KC_Q   , KC_R   , KC_S   , KC_T   , KC_U   , KC_V   , KC_W,
+    KC_X   , KC_Z   , KC_Y   , KC_7   , KC_NUBS, KC_0   , KC_RBRC, KC_DEL,
+};
+// clang-format on
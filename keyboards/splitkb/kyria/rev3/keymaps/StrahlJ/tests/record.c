@@ -0,0 +1,84 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Types text with sim_type() while keylog.c records, and prints what it
+// recorded in the trace format of tools/keylog_dump.py. Makes synthetic
+// traces for build/replay and checks the recorder and the format on the way.
+//
+//     build/record [-h hold_ms] [-g gap_ms] text > traces/name.trace
+
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "keylog.h"
+#include "raw_hid_commands.h"
+
+static void request(uint8_t *data) {
+    raw_hid_receive(data, RAW_EPSIZE);
+    memcpy(data, sim_raw_hid_answer, RAW_EPSIZE);
+}
+
+int main(int argc, char **argv) {
+    uint32_t    hold = 40, gap = 80;
+    const char *text = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-h") && i + 1 < argc) {
+            hold = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-g") && i + 1 < argc) {
+            gap = atoi(argv[++i]);
+        } else {
+            text = argv[i];
+        }
+    }
+    if (!text) {
+        fprintf(stderr, "usage: %s [-h hold_ms] [-g gap_ms] text\n", argv[0]);
+        return 2;
+    }
+
+    sim_init();
+    sim_run(1000);
+
+    uint8_t data[RAW_EPSIZE] = {RAW_HID_KEYLOG_START};
+    request(data);
+    sim_host_clear();
+    if (!sim_type(text, hold, gap)) {
+        fprintf(stderr, "can't type all of \"%s\"\n", text);
+        return 1;
+    }
+    sim_run(1000);
+    data[0] = RAW_HID_KEYLOG_STOP;
+    request(data);
+
+    printf("# keylog trace v1: time_us row col down|up, then the state before the event\n");
+    printf("# matrix %ux%u\n", MATRIX_ROWS, MATRIX_COLS);
+    printf("# synthetic: typed by tests/record with %u ms holds and %u ms gaps\n", hold, gap);
+    // What the host made of it, autocorrections included.
+    printf("# expect: ");
+    for (const char *c = sim_host.text; *c; c++) {
+        if (*c == '\n') {
+            printf("\\n");
+        } else {
+            putchar(*c);
+        }
+    }
+    putchar('\n');
+
+    uint16_t count = 1, start = 0;
+    uint32_t first = 0;
+    for (uint16_t index = 0; index < count;) {
+        memset(data, 0, sizeof(data));
+        data[0] = RAW_HID_KEYLOG_READ;
+        data[1] = index & 0xFF;
+        data[2] = index >> 8;
+        request(data);
+        count = data[1] | data[2] << 8;
+        for (uint8_t n = 0; n < 2 && index < count; n++, index++) {
+            keylog_entry_t entry;
+            memcpy(&entry, data + 5 + n * sizeof(entry), sizeof(entry));
+            if (!start++) first = entry.time_us;
+            printf("%u %u %u %s layer=0x%04X mods=0x%02X osm=0x%02X osm_locked=0x%02X%s%s\n", entry.time_us - first, entry.row, entry.col_pressed & ~KEYLOG_PRESSED, entry.col_pressed & KEYLOG_PRESSED ? "down" : "up", entry.layer_state, entry.mods, entry.oneshot_mods, entry.oneshot_locked_mods, entry.flags & KEYLOG_FLAG_CAPS_WORD ? " caps_word" : "", entry.flags & KEYLOG_FLAG_LEADER ? " leader" : "");
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,86 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Replays keylog traces (tools/keylog_dump.py) against the keymap and prints
+// what the host received, how often the recorded state differs from the
+// simulated one, and how long each user hook took on this machine.
+//
+//     build/replay [-r] [-s] trace...
+//
+// -r prints every report, -s fails on any state mismatch. A trace line
+// "# expect: <text>" fails the replay unless the host ends up with that text,
+// \n and \t escaped. Each trace starts 1 s after the previous one ends.
+
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+static bool read_expected(const char *path, char *expected, size_t size) {
+    FILE *f = fopen(path, "r");
+    char  line[512];
+    bool  found = false;
+
+    if (!f) return false;
+    while (fgets(line, sizeof(line), f)) {
+        if (strncmp(line, "# expect: ", 10)) continue;
+        char  *out = expected;
+        size_t left = size - 1;
+        for (const char *in = line + 10; *in && *in != '\n' && left; in++, left--) {
+            if (in[0] == '\\' && (in[1] == 'n' || in[1] == 't' || in[1] == '\\')) {
+                in++;
+                *out++ = *in == 'n' ? '\n' : *in == 't' ? '\t' : '\\';
+            } else {
+                *out++ = *in;
+            }
+        }
+        *out  = '\0';
+        found = true;
+        break;
+    }
+    fclose(f);
+    return found;
+}
+
+int main(int argc, char **argv) {
+    bool print_reports = false;
+    bool strict        = false;
+    int  traces        = 0;
+
+    sim_init();
+    sim_run(1000);
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-r")) {
+            print_reports = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "-s")) {
+            strict = true;
+            continue;
+        }
+
+        sim_trace_t trace;
+        if (!sim_trace_load(argv[i], &trace)) return 2;
+        sim_reports_clear();
+        sim_host_clear();
+
+        uint32_t divergent = sim_replay(&trace, 1000);
+        printf("%s: %zu events, %u state mismatches, %zu reports, %u with several new keys\n", argv[i], trace.count, divergent, sim_report_count(SIM_REPORT_KEYBOARD) + sim_report_count(SIM_REPORT_NKRO), sim_host.ambiguous);
+        printf("typed: \"%s\"\n", sim_host.text);
+        if (print_reports) sim_print_reports(stdout);
+
+        char expected[512];
+        if (read_expected(argv[i], expected, sizeof(expected))) {
+            CHECK(!strcmp(sim_host.text, expected), "%s: expected \"%s\"", argv[i], expected);
+        }
+        if (strict) CHECK(divergent == 0, "%s: %u events differ from the recorded state", argv[i], divergent);
+        sim_trace_free(&trace);
+        traces++;
+    }
+    if (!traces) {
+        fprintf(stderr, "usage: %s [-r] [-s] trace...\n", argv[0]);
+        return 2;
+    }
+    putchar('\n');
+    sim_print_hooks(stdout);
+    return sim_exit_code();
+}
@@ -0,0 +1,507 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+uint32_t sim_failures;
+
+int sim_exit_code(void) {
+    if (sim_failures) fprintf(stderr, "%u checks failed\n", sim_failures);
+    return sim_failures ? 1 : 0;
+}
+
+// Report log
+
+static sim_report_t *reports;
+static size_t        reports_count;
+static size_t        reports_capacity;
+
+static sim_report_t *report_add(sim_report_type_t type) {
+    if (reports_count == reports_capacity) {
+        reports_capacity = reports_capacity ? reports_capacity * 2 : 256;
+        reports          = realloc(reports, reports_capacity * sizeof(*reports));
+        if (!reports) abort();
+    }
+    sim_report_t *report = &reports[reports_count++];
+    memset(report, 0, sizeof(*report));
+    report->time = timer_read32();
+    report->type = type;
+    return report;
+}
+
+const sim_report_t *sim_reports(size_t *count) {
+    *count = reports_count;
+    return reports;
+}
+
+size_t sim_report_count(sim_report_type_t type) {
+    size_t count = 0;
+    for (size_t i = 0; i < reports_count; i++) {
+        if (reports[i].type == type) count++;
+    }
+    return count;
+}
+
+void sim_reports_clear(void) {
+    reports_count = 0;
+}
+
+// Host: what a German layout on Linux makes of the reports.
+
+sim_host_t sim_host;
+
+static uint8_t  host_keys[32]; // keys held, as a bitmap of usages
+static uint8_t  host_mods;
+static bool     host_unicode;  // inside Ctrl+Shift+U code point entry
+static uint32_t host_code_point;
+static char     host_dead;     // pending dead key
+
+void sim_host_clear(void) {
+    led_t leds = sim_host.leds;
+    memset(&sim_host, 0, sizeof(sim_host));
+    sim_host.leds = leds;
+    host_unicode  = false;
+    host_dead     = 0;
+}
+
+static void host_append(const char *s) {
+    size_t length = strlen(sim_host.text);
+    if (length + strlen(s) < sizeof(sim_host.text)) strcat(sim_host.text, s);
+}
+
+static void host_append_code_point(uint32_t cp) {
+    char utf8[5] = {0};
+    if (cp < 0x80) {
+        utf8[0] = cp;
+    } else if (cp < 0x800) {
+        utf8[0] = 0xC0 | cp >> 6;
+        utf8[1] = 0x80 | (cp & 0x3F);
+    } else if (cp < 0x10000) {
+        utf8[0] = 0xE0 | cp >> 12;
+        utf8[1] = 0x80 | ((cp >> 6) & 0x3F);
+        utf8[2] = 0x80 | (cp & 0x3F);
+    } else {
+        utf8[0] = 0xF0 | cp >> 18;
+        utf8[1] = 0x80 | ((cp >> 12) & 0x3F);
+        utf8[2] = 0x80 | ((cp >> 6) & 0x3F);
+        utf8[3] = 0x80 | (cp & 0x3F);
+    }
+    host_append(utf8);
+}
+
+static void host_backspace(void) {
+    size_t length = strlen(sim_host.text);
+    while (length > 0 && (sim_host.text[length - 1] & 0xC0) == 0x80) {
+        length--;
+    }
+    if (length > 0) length--;
+    sim_host.text[length] = '\0';
+}
+
+// Characters the sendstring LUTs don't cover.
+static const char *host_extra_char(uint8_t key, bool shift, bool altgr) {
+    if (altgr) {
+        switch (key) {
+            case KC_E:
+                return "€";
+            case KC_2:
+                return "²";
+            case KC_3:
+                return "³";
+            case KC_M:
+                return "µ";
+        }
+        return NULL;
+    }
+    switch (key) {
+        case KC_SCLN:
+            return shift ? "Ö" : "ö";
+        case KC_QUOT:
+            return shift ? "Ä" : "ä";
+        case KC_LBRC:
+            return shift ? "Ü" : "ü";
+        case KC_MINS:
+            return shift ? NULL : "ß";
+        case KC_GRV:
+            return shift ? "°" : NULL;
+        case KC_3:
+            return shift ? "§" : NULL;
+        case KC_EQL:
+            return shift ? NULL : "´";
+    }
+    return NULL;
+}
+
+static void host_char(uint8_t key, bool shift, bool altgr) {
+    char text[2] = {0};
+
+    if (key >= KC_A && key <= KC_Z && !altgr) {
+        uint8_t letter = key == KC_Y ? 'z' : key == KC_Z ? 'y' : 'a' + key - KC_A;
+        text[0]        = (shift ^ sim_host.leds.caps_lock) ? letter - 'a' + 'A' : letter;
+    } else if (key == KC_SPC) {
+        text[0] = ' ';
+    } else {
+        const char *extra = host_extra_char(key, shift ^ (sim_host.leds.caps_lock && (key == KC_SCLN || key == KC_QUOT || key == KC_LBRC)), altgr);
+        if (extra) {
+            host_append(extra);
+            return;
+        }
+        for (uint8_t ascii = 0x21; ascii < 0x7F; ascii++) {
+            if (ascii_to_keycode_lut[ascii] == key && PGM_LOADBIT(ascii_to_shift_lut, ascii) == shift && PGM_LOADBIT(ascii_to_altgr_lut, ascii) == altgr) {
+                text[0] = ascii;
+                break;
+            }
+        }
+        if (text[0] && PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)text[0])) {
+            host_dead = text[0];
+            return;
+        }
+    }
+    if (text[0]) host_append(text);
+}
+
+static void host_key(uint8_t key, uint8_t mods) {
+    bool shift = mods & MOD_MASK_SHIFT;
+    bool altgr = mods & MOD_BIT(KC_RALT);
+
+    switch (key) {
+        case KC_CAPS:
+            sim_host.leds.caps_lock = !sim_host.leds.caps_lock;
+            return;
+        case KC_NUM:
+            sim_host.leds.num_lock = !sim_host.leds.num_lock;
+            return;
+        case KC_SCRL:
+            sim_host.leds.scroll_lock = !sim_host.leds.scroll_lock;
+            return;
+    }
+    if (IS_MODIFIER_KEYCODE(key)) return;
+
+    if (host_unicode) {
+        if (key >= KC_1 && key <= KC_0) {
+            host_code_point = host_code_point << 4 | (key == KC_0 ? 0 : key - KC_1 + 1);
+        } else if (key >= KC_A && key <= KC_F) {
+            host_code_point = host_code_point << 4 | (key - KC_A + 10);
+        } else {
+            host_unicode = false;
+            if (key == KC_SPC || key == KC_ENT) host_append_code_point(host_code_point);
+        }
+        return;
+    }
+    if (key == KC_U && (mods & MOD_MASK_CTRL) && shift && !(mods & (MOD_MASK_GUI | MOD_BIT(KC_LALT)))) {
+        host_unicode    = true;
+        host_code_point = 0;
+        return;
+    }
+    if ((mods & (MOD_MASK_CTRL | MOD_MASK_GUI | MOD_BIT(KC_LALT))) != 0) {
+        sim_host.shortcuts++;
+        return;
+    }
+    if (host_dead) {
+        char dead[2] = {host_dead, 0};
+        host_dead    = 0;
+        host_append(dead);
+        if (key == KC_SPC) return;
+    }
+    switch (key) {
+        case KC_BSPC:
+            host_backspace();
+            return;
+        case KC_ENT:
+            host_append("\n");
+            return;
+        case KC_TAB:
+            host_append("\t");
+            return;
+    }
+    host_char(key, shift, altgr);
+}
+
+// Presses every key that is new in `keys`, in the order the report lists
+// them. Several new keys with an effect in one report are ambiguous: USB HID
+// doesn't say in what order the host handles them. New keys with a change of
+// modifiers are counted apart, QMK itself sends one-shot mods that way.
+static void host_keys_report(const uint8_t *keys, uint8_t count, uint8_t mods) {
+    uint8_t pressed[32] = {0};
+    uint8_t new_keys[256];
+    uint8_t new_count = 0;
+
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t key = keys[i];
+        if (!key) continue;
+        pressed[key >> 3] |= 1 << (key & 7);
+        if (!(host_keys[key >> 3] & (1 << (key & 7)))) new_keys[new_count++] = key;
+    }
+    memcpy(host_keys, pressed, sizeof(host_keys));
+    if (new_count > 1) sim_host.ambiguous++;
+    if (new_count && mods != host_mods) sim_host.mods_with_keys++;
+    host_mods = mods;
+    for (uint8_t i = 0; i < new_count; i++) {
+        host_key(new_keys[i], mods);
+    }
+}
+
+static uint8_t host_leds(void) {
+    return sim_host.leds.raw;
+}
+
+static void host_send_keyboard(report_keyboard_t *report) {
+    report_add(SIM_REPORT_KEYBOARD)->keyboard = *report;
+    host_keys_report(report->keys, KEYBOARD_REPORT_KEYS, report->mods);
+}
+
+static void host_send_nkro(report_nkro_t *report) {
+    uint8_t keys[NKRO_REPORT_BITS * 8];
+    uint8_t count = 0;
+
+    report_add(SIM_REPORT_NKRO)->nkro = *report;
+    for (uint16_t key = 0; key < NKRO_REPORT_BITS * 8; key++) {
+        if (report->bits[key >> 3] & (1 << (key & 7))) keys[count++] = key;
+    }
+    host_keys_report(keys, count, report->mods);
+}
+
+static void host_send_mouse(report_mouse_t *report) {
+    report_add(SIM_REPORT_MOUSE)->mouse = *report;
+    sim_host.x += report->x;
+    sim_host.y += report->y;
+    sim_host.wheel_v += report->v;
+    sim_host.wheel_h += report->h;
+    sim_host.buttons = report->buttons;
+}
+
+static void host_send_extra(report_extra_t *report) {
+    report_add(SIM_REPORT_EXTRA)->extra = *report;
+}
+
+static host_driver_t host_driver = {
+    .keyboard_leds = host_leds,
+    .send_keyboard = host_send_keyboard,
+    .send_nkro     = host_send_nkro,
+    .send_mouse    = host_send_mouse,
+    .send_extra    = host_send_extra,
+};
+
+// Driving the keyboard
+
+void sim_init(void) {
+    host_set_driver(&host_driver);
+    keyboard_init();
+}
+
+void sim_run(uint32_t ms) {
+    while (ms--) {
+        keyboard_task();
+        timer_advance_us(1000);
+    }
+}
+
+void sim_press(uint8_t row, uint8_t col) {
+    matrix_set_key(row, col, true);
+}
+
+void sim_release(uint8_t row, uint8_t col) {
+    matrix_set_key(row, col, false);
+}
+
+void sim_tap(uint8_t row, uint8_t col, uint32_t hold_ms, uint32_t gap_ms) {
+    sim_press(row, col);
+    sim_run(hold_ms);
+    sim_release(row, col);
+    sim_run(gap_ms);
+}
+
+bool sim_find_key(uint16_t keycode, uint8_t layer, keypos_t *key) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (keycode_at_keymap_location(layer, row, col) == keycode) {
+                *key = MAKE_KEYPOS(row, col);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool sim_tap_keycode(uint16_t keycode, uint8_t layer, uint32_t hold_ms, uint32_t gap_ms) {
+    keypos_t key;
+    if (!sim_find_key(keycode, layer, &key)) return false;
+    sim_tap(key.row, key.col, hold_ms, gap_ms);
+    return true;
+}
+
+bool sim_type(const char *text, uint32_t hold_ms, uint32_t gap_ms) {
+    for (; *text; text++) {
+        char     c = *text;
+        uint16_t keycode;
+
+        if (c >= 'A' && c <= 'Z') {
+            if (!sim_tap_keycode(OSM(MOD_LSFT), 0, hold_ms, gap_ms)) return false;
+            c = c - 'A' + 'a';
+        }
+        switch (c) {
+            case 'a' ... 'z':
+                // German layout: Y and Z trade places.
+                keycode = c == 'y' ? KC_Z : c == 'z' ? KC_Y : KC_A + c - 'a';
+                break;
+            case ' ':
+                keycode = KC_SPC;
+                break;
+            case '\n':
+                keycode = MT(MOD_LALT, KC_ENT);
+                break;
+            case ',':
+                keycode = KC_COMM;
+                break;
+            case '.':
+                keycode = KC_DOT;
+                break;
+            case '-':
+                keycode = KC_SLSH;
+                break;
+            default:
+                return false;
+        }
+        if (!sim_tap_keycode(keycode, 0, hold_ms, gap_ms)) return false;
+    }
+    return true;
+}
+
+// Traces
+
+bool sim_trace_load(const char *path, sim_trace_t *trace) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+
+    size_t capacity = 0;
+    char   line[256];
+    int    number = 0;
+
+    trace->events = NULL;
+    trace->count  = 0;
+    while (fgets(line, sizeof(line), f)) {
+        number++;
+        unsigned rows, cols;
+        if (sscanf(line, "# matrix %ux%u", &rows, &cols) == 2 && (rows != MATRIX_ROWS || cols != MATRIX_COLS)) {
+            fprintf(stderr, "%s:%d: recorded on a %ux%u matrix, this build has %ux%u\n", path, number, rows, cols, MATRIX_ROWS, MATRIX_COLS);
+            fclose(f);
+            sim_trace_free(trace);
+            return false;
+        }
+        if (line[0] == '#' || line[0] == '\n') continue;
+
+        sim_trace_event_t event = {0};
+        unsigned          time_us, row, col, layer, mods, osm, osm_locked;
+        char              action[8];
+        int               consumed = 0;
+        int               fields   = sscanf(line, "%u %u %u %7s layer=0x%x mods=0x%x osm=0x%x osm_locked=0x%x%n", &time_us, &row, &col, action, &layer, &mods, &osm, &osm_locked, &consumed);
+
+        if (fields < 4 || row >= MATRIX_ROWS || col >= MATRIX_COLS || (strcmp(action, "down") && strcmp(action, "up"))) {
+            fprintf(stderr, "%s:%d: expected \"<time_us> <row> <col> down|up [state]\"\n", path, number);
+            fclose(f);
+            sim_trace_free(trace);
+            return false;
+        }
+        event.time_us = time_us;
+        event.row     = row;
+        event.col     = col;
+        event.pressed = action[0] == 'd';
+        if (fields == 8) {
+            event.has_state           = true;
+            event.layer_state         = layer;
+            event.mods                = mods;
+            event.oneshot_mods        = osm;
+            event.oneshot_locked_mods = osm_locked;
+            event.caps_word           = strstr(line + consumed, "caps_word") != NULL;
+            event.leader              = strstr(line + consumed, "leader") != NULL;
+        }
+
+        if (trace->count == capacity) {
+            capacity      = capacity ? capacity * 2 : 256;
+            trace->events = realloc(trace->events, capacity * sizeof(*trace->events));
+            if (!trace->events) abort();
+        }
+        trace->events[trace->count++] = event;
+    }
+    fclose(f);
+    return true;
+}
+
+void sim_trace_free(sim_trace_t *trace) {
+    free(trace->events);
+    trace->events = NULL;
+    trace->count  = 0;
+}
+
+// The keylog records the state at the end of the scan that saw the change,
+// before its events are processed, so it is compared right before the event
+// goes into the matrix.
+static bool state_matches(const sim_trace_event_t *event) {
+    return layer_state == event->layer_state && get_mods() == event->mods && get_oneshot_mods() == event->oneshot_mods && get_oneshot_locked_mods() == event->oneshot_locked_mods && is_caps_word_on() == event->caps_word && leader_sequence_active() == event->leader;
+}
+
+uint32_t sim_replay(const sim_trace_t *trace, uint32_t settle_ms) {
+    uint64_t start     = timer_now_us();
+    uint32_t divergent = 0;
+
+    for (size_t i = 0; i < trace->count; i++) {
+        const sim_trace_event_t *event = &trace->events[i];
+        // One scan per ms: the event is seen by the first scan at or after its time.
+        while (timer_now_us() < start + event->time_us) {
+            sim_run(1);
+        }
+        if (event->has_state && !state_matches(event)) {
+            if (divergent < 5) {
+                fprintf(stderr, "event %zu at %u us: recorded layer=0x%04X mods=0x%02X osm=0x%02X, simulated layer=0x%04X mods=0x%02X osm=0x%02X\n", i, event->time_us, event->layer_state, event->mods, event->oneshot_mods, layer_state, get_mods(), get_oneshot_mods());
+            }
+            divergent++;
+        }
+        matrix_set_key(event->row, event->col, event->pressed);
+    }
+    sim_run(settle_ms);
+    return divergent;
+}
+
+// Output
+
+void sim_print_hooks(FILE *out) {
+    fprintf(out, "%-26s %8s %10s %10s\n", "hook", "calls", "avg ns", "max ns");
+    for (uint8_t i = 0; i < SIM_HOOK_COUNT; i++) {
+        const sim_hook_stat_t *stat = &sim_hooks[i];
+        if (!stat->calls) continue;
+        fprintf(out, "%-26s %8u %10llu %10llu\n", sim_hook_names[i], stat->calls, (unsigned long long)(stat->total_ns / stat->calls), (unsigned long long)stat->max_ns);
+    }
+}
+
+void sim_print_reports(FILE *out) {
+    for (size_t i = 0; i < reports_count; i++) {
+        const sim_report_t *report = &reports[i];
+        fprintf(out, "%8u ", report->time);
+        switch (report->type) {
+            case SIM_REPORT_KEYBOARD:
+                fprintf(out, "keyboard mods=0x%02X keys=", report->keyboard.mods);
+                for (uint8_t k = 0; k < KEYBOARD_REPORT_KEYS; k++) {
+                    fprintf(out, "%02X%s", report->keyboard.keys[k], k + 1 < KEYBOARD_REPORT_KEYS ? " " : "\n");
+                }
+                break;
+            case SIM_REPORT_NKRO:
+                fprintf(out, "nkro mods=0x%02X keys=", report->nkro.mods);
+                for (uint16_t key = 0; key < NKRO_REPORT_BITS * 8; key++) {
+                    if (report->nkro.bits[key >> 3] & (1 << (key & 7))) fprintf(out, "%02X ", key);
+                }
+                fputc('\n', out);
+                break;
+            case SIM_REPORT_MOUSE:
+                fprintf(out, "mouse buttons=0x%02X x=%d y=%d v=%d h=%d\n", report->mouse.buttons, report->mouse.x, report->mouse.y, report->mouse.v, report->mouse.h);
+                break;
+            case SIM_REPORT_EXTRA:
+                fprintf(out, "extra id=%u usage=0x%03X\n", report->extra.report_id, report->extra.usage);
+                break;
+        }
+    }
+}
@@ -0,0 +1,229 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Host simulation of the keymap: the stand-in QMK core in qmk/core.c runs
+// keymap.c and its modules on a virtual millisecond clock, sim.c drives it
+// with key events or keylog traces and plays the host that receives the
+// reports. One scan per virtual millisecond.
+
+#include <stdio.h>
+#include "quantum.h"
+
+// Stand-in core (qmk/core.c).
+
+// Resets the core and calls keyboard_post_init_user(). Module state of the
+// keymap itself is only reset by starting a new process.
+void keyboard_init(void);
+// One pass of QMK's main loop: matrix scan, key events, tapping timeouts,
+// leader, caps word and one-shot timeouts, OLED task and housekeeping.
+void keyboard_task(void);
+// Sets the debounced state of a key, turned into an event by the next scan.
+void matrix_set_key(uint8_t row, uint8_t col, bool pressed);
+// Sets the raw state of a switch instead. Once used, every scan runs it
+// through the debounce DEBOUNCE_TYPE in ../rules.mk selects into the state
+// above, or copies it straight over when `sim_debounce` is false. Don't mix
+// the two per process.
+void        matrix_set_raw(uint8_t row, uint8_t col, bool pressed);
+extern bool sim_debounce;
+void suspend_power_down(void);
+void suspend_wakeup_init(void);
+
+void     timer_advance_us(uint32_t us);
+uint64_t timer_now_us(void);
+
+// User hooks, each call timed with the host's monotonic clock. Hooks called
+// from within other hooks count towards both.
+typedef enum {
+    SIM_HOOK_PRE_PROCESS_RECORD,
+    SIM_HOOK_PROCESS_RECORD,
+    SIM_HOOK_POST_PROCESS_RECORD,
+    SIM_HOOK_MATRIX_SCAN,
+    SIM_HOOK_HOUSEKEEPING,
+    SIM_HOOK_OLED_TASK,
+    SIM_HOOK_LAYER_STATE_SET,
+    SIM_HOOK_CAPS_WORD_PRESS,
+    SIM_HOOK_LEADER_END,
+    SIM_HOOK_TAPPING_TERM,
+    SIM_HOOK_AUTOCORRECT,
+    SIM_HOOK_COUNT,
+} sim_hook_t;
+
+typedef struct {
+    uint32_t calls;
+    uint64_t total_ns;
+    uint64_t max_ns;
+} sim_hook_stat_t;
+
+extern sim_hook_stat_t sim_hooks[SIM_HOOK_COUNT];
+extern const char     *sim_hook_names[SIM_HOOK_COUNT];
+
+// How every mod-tap, layer-tap, OSM and OSL press was settled.
+typedef struct {
+    uint16_t keycode;
+    keypos_t key;
+    uint32_t pressed;    // ms
+    uint32_t settled;    // ms
+    bool     tap;
+    bool     flow_tap;   // settled on press by FLOW_TAP_TERM
+    bool     chord_tap;  // settled by chordal hold
+    bool     interrupted;
+} sim_tap_hold_t;
+
+extern void (*sim_tap_hold_callback)(const sim_tap_hold_t *decision);
+
+// Writes to the user datablock. `budget` counts down with every write that
+// changes something; once it reaches zero further writes are dropped, as if
+// power was lost. Negative means unlimited. The first dropped write still
+// stores its first `tear` bytes, a write cut off halfway.
+typedef struct {
+    uint32_t writes;
+    uint32_t bytes;
+    uint32_t writes_in_keys; // made while a key event was being processed
+    uint32_t bytes_in_keys;
+    int32_t  budget;
+    uint32_t tear;
+} sim_flash_t;
+
+extern sim_flash_t sim_flash;
+uint8_t           *sim_datablock(void);
+
+// Split transport: messages sent to the slave and the bytes they take on the
+// wire, framing included. With `loopback` the slave's handler runs right away
+// in this process, as the slave.
+typedef struct {
+    bool     master;
+    bool     loopback;
+    uint32_t messages;
+    uint32_t bytes;
+} sim_split_t;
+
+extern sim_split_t sim_split;
+
+// OLED buffer and its character grid, '\0' where raw bytes were written.
+typedef struct {
+    uint32_t bytes_changed;
+    uint32_t chars_written;
+} sim_oled_t;
+
+extern sim_oled_t sim_oled;
+const uint8_t    *sim_oled_buffer(void);
+char              sim_oled_char(uint8_t col, uint8_t line);
+
+extern uint8_t sim_unicode_mode;
+extern bool    sim_console;
+
+// Cells read from keymaps[] through keycode_at_keymap_location().
+extern uint32_t sim_keymap_reads;
+
+// Last answer passed to raw_hid_send().
+extern uint8_t  sim_raw_hid_answer[RAW_EPSIZE];
+extern uint32_t sim_raw_hid_answers;
+
+// Harness (sim.c).
+
+// Sets up the host driver and the core, call once per process.
+void sim_init(void);
+
+// Runs `ms` scans.
+void sim_run(uint32_t ms);
+// Press or release the key at a matrix position, processed by the next scan.
+void sim_press(uint8_t row, uint8_t col);
+void sim_release(uint8_t row, uint8_t col);
+// Press, hold for `hold_ms`, release, then idle for `gap_ms`.
+void sim_tap(uint8_t row, uint8_t col, uint32_t hold_ms, uint32_t gap_ms);
+// Finds `keycode` on `layer`. Returns false if it isn't there.
+bool sim_find_key(uint16_t keycode, uint8_t layer, keypos_t *key);
+// Taps the key that has `keycode` on `layer`, see sim_tap().
+bool sim_tap_keycode(uint16_t keycode, uint8_t layer, uint32_t hold_ms, uint32_t gap_ms);
+// Types a-z, A-Z (one-shot shift first), space, '\n', ',', '.' and '-' on
+// the base layer, each key held `hold_ms` and followed by `gap_ms`. Returns
+// false at the first character it can't type.
+bool sim_type(const char *text, uint32_t hold_ms, uint32_t gap_ms);
+
+// Every report the host received since the last clear.
+typedef enum {
+    SIM_REPORT_KEYBOARD,
+    SIM_REPORT_NKRO,
+    SIM_REPORT_MOUSE,
+    SIM_REPORT_EXTRA,
+} sim_report_type_t;
+
+typedef struct {
+    uint32_t          time; // ms
+    sim_report_type_t type;
+    union {
+        report_keyboard_t keyboard;
+        report_nkro_t     nkro;
+        report_mouse_t    mouse;
+        report_extra_t    extra;
+    };
+} sim_report_t;
+
+const sim_report_t *sim_reports(size_t *count);
+size_t              sim_report_count(sim_report_type_t type);
+void                sim_reports_clear(void);
+
+// The host: a German layout with IBus' Ctrl+Shift+U code point entry, and
+// the pointer the mouse reports move. Text is UTF-8.
+typedef struct {
+    char     text[4096];
+    uint32_t ambiguous;      // reports pressing several keys whose order matters
+    uint32_t mods_with_keys; // reports pressing keys and changing modifiers
+    uint32_t shortcuts; // presses with Ctrl, Alt or GUI, not typed as text
+    int32_t  x, y;
+    int32_t  wheel_v, wheel_h;
+    uint8_t  buttons;
+    led_t    leds;
+} sim_host_t;
+
+extern sim_host_t sim_host;
+void              sim_host_clear(void);
+
+// Keylog traces as written by tools/keylog_dump.py.
+typedef struct {
+    uint32_t      time_us;
+    uint8_t       row;
+    uint8_t       col;
+    bool          pressed;
+    bool          has_state;
+    layer_state_t layer_state;
+    uint8_t       mods;
+    uint8_t       oneshot_mods;
+    uint8_t       oneshot_locked_mods;
+    bool          caps_word;
+    bool          leader;
+} sim_trace_event_t;
+
+typedef struct {
+    sim_trace_event_t *events;
+    size_t             count;
+} sim_trace_t;
+
+// Returns false with a message on stderr if the file can't be read or parsed.
+bool sim_trace_load(const char *path, sim_trace_t *trace);
+void sim_trace_free(sim_trace_t *trace);
+
+// Feeds the events at their recorded times, then lets `settle_ms` pass.
+// Returns the number of events whose recorded layer, mods, one-shot mods, caps
+// word or leader state differs from the simulation's just before the event.
+uint32_t sim_replay(const sim_trace_t *trace, uint32_t settle_ms);
+
+void sim_print_hooks(FILE *out);
+void sim_print_reports(FILE *out);
+
+// Minimal checks for the test programs: a failed CHECK prints and counts,
+// sim_exit_code() is what main() returns.
+extern uint32_t sim_failures;
+#define CHECK(cond, ...)                                                    \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            sim_failures++;                                                 \
+            fprintf(stderr, "%s:%d: check failed: %s: ", __FILE__, __LINE__, #cond); \
+            fprintf(stderr, __VA_ARGS__);                                   \
+            fputc('\n', stderr);                                            \
+        }                                                                   \
+    } while (0)
+
+int sim_exit_code(void);
@@ -0,0 +1,251 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The autocorrect overlay's storage: power lost at every write of a
+// compaction, an append and a replacement, each followed by a reboot that
+// must find the rules from before or after the change and nothing else. Then
+// learn mode: its OLED line, the timeout, shifted and AltGr characters, and
+// no flash writes while keys are processed. The cost per keystroke is
+// measured in test_ac_overlay_lookup.c.
+
+#include <stdlib.h>
+#include "sim.h"
+#include "keymap_german.h"
+#include "raw_hid_commands.h"
+#include "user_data.h"
+#include "ac_overlay.h"
+
+#define LISTING_SIZE 16384
+
+typedef struct {
+    char typo[AC_OVERLAY_MAX_TYPO + 1];
+    char correction[AC_OVERLAY_MAX_CORRECTION + 1];
+} rule_t;
+
+static uint8_t snapshot[EECONFIG_USER_DATA_SIZE];
+
+static void random_word(char *out, uint8_t min, uint8_t max) {
+    uint8_t length = min + rand() % (max - min + 1);
+    for (uint8_t i = 0; i < length; i++) {
+        out[i] = 'a' + rand() % 26;
+    }
+    out[length] = '\0';
+}
+
+// A whole word typo half the time, otherwise one with a boundary at one end or none.
+static rule_t random_rule(void) {
+    rule_t  rule;
+    uint8_t kind = rand() % 4;
+    bool    head = kind != 3, tail = kind != 2;
+
+    rule.typo[0] = ':';
+    random_word(rule.typo + head, 3, AC_OVERLAY_MAX_TYPO - 2);
+    if (tail) strcat(rule.typo, ":");
+    random_word(rule.correction, 1, AC_OVERLAY_MAX_CORRECTION);
+    return rule;
+}
+
+// The live rules as "typo>correction" lines, read back over raw HID.
+static void list_rules(char *out) {
+    size_t length = 0;
+
+    out[0] = '\0';
+    for (uint16_t index = 0;; index++) {
+        uint8_t data[RAW_EPSIZE] = {RAW_HID_AC_OVERLAY_LIST, index & 0xFF, index >> 8};
+        raw_hid_receive(data, sizeof(data));
+        if (sim_raw_hid_answer[1] != AC_OVERLAY_OK) break;
+
+        const char *typo       = (const char *)sim_raw_hid_answer + 2;
+        const char *correction = typo + strlen(typo) + 1;
+        length += snprintf(out + length, LISTING_SIZE - length, "%s>%s\n", typo, correction);
+    }
+}
+
+static uint16_t count_lines(const char *listing) {
+    uint16_t lines = 0;
+    for (; *listing; listing++) {
+        lines += *listing == '\n';
+    }
+    return lines;
+}
+
+static void save_snapshot(void) {
+    memcpy(snapshot, sim_datablock(), sizeof(snapshot));
+}
+
+static void restore_snapshot(void) {
+    memcpy(sim_datablock(), snapshot, sizeof(snapshot));
+    ac_overlay_init();
+}
+
+static void reboot(void) {
+    sim_flash.budget = -1;
+    sim_flash.tear   = 0;
+    ac_overlay_init();
+}
+
+// Runs `change` from the snapshot with power lost after every number of
+// writes it makes, each write cut off after `tear` bytes as well as whole.
+// Every reboot must find `before` or `after`.
+static void power_loss(const char *name, void (*change)(void), const char *before, const char *after) {
+    static char listing[LISTING_SIZE];
+    static const uint32_t tears[] = {0, 1, 3, 40, 1000};
+    uint32_t              runs = 0, old = 0;
+    int32_t               budget;
+
+    for (budget = 0;; budget++) {
+        bool finished = false;
+        for (uint8_t t = 0; t < ARRAY_SIZE(tears); t++) {
+            restore_snapshot();
+            sim_flash.budget = budget;
+            sim_flash.tear   = tears[t];
+            change();
+            finished = sim_flash.budget > 0;
+            reboot();
+            list_rules(listing);
+            runs++;
+            old += !strcmp(listing, before);
+            CHECK(!strcmp(listing, before) || !strcmp(listing, after), "%s: power lost after %d writes, %u bytes into the next: %u rules, %u before, %u after", name, budget, tears[t], count_lines(listing), count_lines(before), count_lines(after));
+        }
+        if (finished) break;
+    }
+    printf("%-12s %8d %8u %8u\n", name, budget - 1, runs, old);
+}
+
+static void compact_when_idle(void) {
+    sim_run(AC_OVERLAY_COMPACT_IDLE + 100);
+}
+
+static rule_t changed;
+
+static void add_changed(void) {
+    ac_overlay_add(changed.typo, changed.correction);
+}
+
+static void test_power_loss(void) {
+    static char   before[LISTING_SIZE], after[LISTING_SIZE];
+    static rule_t rules[400];
+    uint16_t      count = 0;
+
+    // Fill the region, then delete every other rule so compaction is due.
+    srand(7);
+    while (count < ARRAY_SIZE(rules)) {
+        rules[count] = random_rule();
+        ac_overlay_result_t result = ac_overlay_add(rules[count].typo, rules[count].correction);
+        if (result == AC_OVERLAY_FULL) break;
+        if (result == AC_OVERLAY_OK) count++;
+    }
+    for (uint16_t i = 0; i < count; i += 2) {
+        CHECK(ac_overlay_delete(rules[i].typo) == AC_OVERLAY_OK, "delete %s", rules[i].typo);
+    }
+    list_rules(before);
+    printf("%u rules added, %u left\n", count, count_lines(before));
+    save_snapshot();
+
+    printf("%-12s %8s %8s %8s\n", "change", "writes", "runs", "old");
+    power_loss("compaction", compact_when_idle, before, before);
+
+    // The region is still full, so this replacement compacts first.
+    changed = rules[1];
+    strcpy(changed.correction, "replaced");
+    restore_snapshot();
+    CHECK(ac_overlay_add(changed.typo, changed.correction) == AC_OVERLAY_OK, "replace %s", changed.typo);
+    list_rules(after);
+    CHECK(count_lines(after) == count_lines(before) && strstr(after, "replaced"), "the rule is replaced after compacting");
+    power_loss("compact+set", add_changed, before, after);
+
+    // A new rule and a replaced one, appended after compaction.
+    restore_snapshot();
+    compact_when_idle();
+    save_snapshot();
+    changed = random_rule();
+    add_changed();
+    list_rules(after);
+    CHECK(count_lines(after) == count_lines(before) + 1, "one rule more after the add");
+    power_loss("add", add_changed, before, after);
+
+    changed = rules[3];
+    strcpy(changed.correction, "replaced");
+    restore_snapshot();
+    add_changed();
+    list_rules(after);
+    CHECK(count_lines(after) == count_lines(before) && strstr(after, "replaced"), "the rule is replaced");
+    power_loss("replace", add_changed, before, after);
+}
+
+// Learn mode.
+
+#define SYM_LAYER 2
+
+static bool oled_shows(const char *text) {
+    for (uint8_t col = 0; text[col]; col++) {
+        if (sim_oled_char(col, 3) != text[col]) return false;
+    }
+    return true;
+}
+
+static void leader_learn(void) {
+    CHECK(sim_tap_keycode(QK_LEAD, 0, 40, 80), "leader key on the base layer");
+    sim_type("al", 40, 80);
+    sim_run(LEADER_TIMEOUT + 100);
+}
+
+static void test_learn(void) {
+    static char listing[LISTING_SIZE];
+
+    ac_overlay_clear();
+    sim_host_clear();
+    leader_learn();
+    CHECK(ac_overlay_learn_state() == AC_OVERLAY_LEARN_TYPO && oled_shows("Learn typo"), "leader A L starts learn mode, state %u", ac_overlay_learn_state());
+    sim_type("qqx ", 40, 80);
+    CHECK(ac_overlay_learn_state() == AC_OVERLAY_LEARN_CORRECTION && oled_shows("Learn fix"), "space moves on to the correction, state %u", ac_overlay_learn_state());
+    sim_type("quux\n", 40, 80);
+    CHECK(ac_overlay_learn_state() == AC_OVERLAY_LEARN_LEARNED && oled_shows("Rule learned"), "enter saves the rule, state %u", ac_overlay_learn_state());
+    list_rules(listing);
+    CHECK(!strcmp(listing, ":qqx:>quux\n"), "learned \"%s\"", listing);
+    sim_run(AC_OVERLAY_LEARN_SHOW);
+    CHECK(ac_overlay_learn_state() == AC_OVERLAY_LEARN_OFF && oled_shows("            "), "the outcome is shown for %u ms", AC_OVERLAY_LEARN_SHOW);
+
+    sim_host_clear();
+    sim_type("qqx ", 40, 80);
+    CHECK(!strcmp(sim_host.text, "quux "), "the rule corrects, typed \"%s\"", sim_host.text);
+
+    // Leader A L by accident, then typing on: the timeout ends learn mode.
+    leader_learn();
+    sim_type("hello ", 40, 80);
+    sim_run(AC_OVERLAY_LEARN_TIMEOUT);
+    CHECK(ac_overlay_learn_state() == AC_OVERLAY_LEARN_CANCELLED && oled_shows("Not learned"), "learn mode times out, state %u", ac_overlay_learn_state());
+    sim_type("there\n", 40, 80);
+    sim_run(AC_OVERLAY_LEARN_SHOW);
+    list_rules(listing);
+    CHECK(!strstr(listing, "hello"), "nothing learned after the timeout: \"%s\"", listing);
+
+    // Shifted digits and punctuation, and AltGr.
+    static const uint16_t symbols[] = {DE_EXLM, DE_QUES, DE_AT, DE_EURO};
+    leader_learn();
+    sim_host_clear();
+    sim_type("qqv ", 40, 80);
+    layer_on(SYM_LAYER);
+    for (uint8_t i = 0; i < ARRAY_SIZE(symbols); i++) {
+        CHECK(sim_tap_keycode(symbols[i], SYM_LAYER, 40, 80), "keycode 0x%04X on the symbol layer", symbols[i]);
+    }
+    layer_off(SYM_LAYER);
+    sim_type("\n", 40, 80);
+    CHECK(!strcmp(sim_host.text, "qqv !?@€\n"), "typed \"%s\" while learning", sim_host.text);
+    list_rules(listing);
+    CHECK(strstr(listing, ":qqv:>!?@€\n"), "learned \"%s\"", listing);
+    sim_host_clear();
+    sim_type("qqv ", 40, 80);
+    CHECK(!strcmp(sim_host.text, "!?@€ "), "typed \"%s\"", sim_host.text);
+
+    CHECK(sim_flash.writes_in_keys == 0, "%u writes during key processing", sim_flash.writes_in_keys);
+}
+
+int main(void) {
+    sim_init();
+    sim_run(1000);
+
+    test_power_loss();
+    test_learn();
+    return sim_exit_code();
+}
@@ -0,0 +1,155 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The cost of process_ac_overlay() per keystroke as the overlay fills up to a
+// few hundred rules. A second copy of the module, renamed, times its index
+// lookup through the PROFILE_AC_LOOKUP hooks apart from the whole call, which
+// includes typing a correction, and counts the slots each lookup reads. Those
+// must stay within AC_OVERLAY_MAX_PROBES per typo length in use, whatever
+// the number of rules.
+
+#include <stdlib.h>
+#include <time.h>
+#include "sim.h"
+#include "profile.h"
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static uint64_t lookup_start;
+static uint32_t lookup_ns;
+static uint32_t probes;
+
+#undef PROFILE_BEGIN
+#undef PROFILE_END
+#define PROFILE_BEGIN(slot) (lookup_start = now_ns())
+#define PROFILE_END(slot) (lookup_ns += now_ns() - lookup_start)
+#define AC_OVERLAY_COUNT_PROBE() (probes++)
+
+#define ac_overlay_init bench_init
+#define ac_overlay_add bench_add
+#define ac_overlay_delete bench_delete
+#define ac_overlay_clear bench_clear
+#define ac_overlay_task bench_task
+#define ac_overlay_forget bench_forget
+#define ac_overlay_autocorrect_user bench_autocorrect_user
+#define ac_overlay_learn bench_learn
+#define ac_overlay_learn_state bench_learn_state
+#define process_ac_overlay bench_process
+#define ac_overlay_raw_hid_receive bench_raw_hid_receive
+#include "../ac_overlay.c"
+
+typedef struct {
+    char typo[AC_OVERLAY_MAX_TYPO + 1];
+    char correction[AC_OVERLAY_MAX_CORRECTION + 1];
+} rule_t;
+
+static void random_word(char *out, uint8_t min, uint8_t max) {
+    uint8_t length = min + rand() % (max - min + 1);
+    for (uint8_t i = 0; i < length; i++) {
+        out[i] = 'a' + rand() % 26;
+    }
+    out[length] = '\0';
+}
+
+// A whole word typo half the time, otherwise one with a boundary at one end or none.
+static rule_t random_rule(void) {
+    rule_t  rule;
+    uint8_t kind = rand() % 4;
+    bool    head = kind != 3, tail = kind != 2;
+
+    rule.typo[0] = ':';
+    random_word(rule.typo + head, 3, AC_OVERLAY_MAX_TYPO - 2);
+    if (tail) strcat(rule.typo, ":");
+    random_word(rule.correction, 1, AC_OVERLAY_MAX_CORRECTION);
+    return rule;
+}
+
+#define BENCH_KEYS 200000
+#define BENCH_PASSES 5
+
+static uint32_t call_ns[BENCH_KEYS];
+static uint32_t lookups_ns[BENCH_KEYS];
+static uint16_t bench_keys[BENCH_KEYS];
+
+static int by_value(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void print_times(const char *name, uint32_t *ns) {
+    uint64_t sum = 0;
+
+    for (uint32_t i = 0; i < BENCH_KEYS; i++) {
+        sum += ns[i];
+    }
+    qsort(ns, BENCH_KEYS, sizeof(ns[0]), by_value);
+    printf(" %6s %7.0f %7u %7u %7u", name, (double)sum / BENCH_KEYS, ns[BENCH_KEYS * 99 / 100], ns[BENCH_KEYS * 999 / 1000], ns[BENCH_KEYS - 1]);
+}
+
+int main(void) {
+    static rule_t         rules[600];
+    static const uint16_t counts[] = {0, 25, 50, 100, 200, UINT16_MAX};
+    uint16_t              total    = 0;
+
+    sim_init();
+    sim_run(1000);
+
+    srand(11);
+    bench_clear();
+    while (total < ARRAY_SIZE(rules)) {
+        rules[total] = random_rule();
+        ac_overlay_result_t result = bench_add(rules[total].typo, rules[total].correction);
+        if (result == AC_OVERLAY_FULL) break;
+        if (result == AC_OVERLAY_OK) total++;
+    }
+    CHECK(total >= 200, "the overlay takes hundreds of rules, %u fit", total);
+
+    // Words of 2 to 9 letters and a space, as keycodes.
+    for (uint32_t i = 0; i < BENCH_KEYS;) {
+        for (uint8_t length = 2 + rand() % 8; length-- && i < BENCH_KEYS;) {
+            bench_keys[i++] = KC_A + rand() % 26;
+        }
+        if (i < BENCH_KEYS) bench_keys[i++] = KC_SPC;
+    }
+
+    printf("%5s %7s %6s %7s %7s %7s %7s %6s %7s %7s %7s %7s %6s\n", "rules", "lengths", "", "avg ns", "p99", "p99.9", "max", "", "avg ns", "p99", "p99.9", "max", "probes");
+    for (uint8_t c = 0; c < ARRAY_SIZE(counts); c++) {
+        uint16_t count      = MIN(counts[c], total);
+        uint32_t probes_max = 0;
+
+        bench_clear();
+        for (uint16_t i = 0; i < count; i++) {
+            bench_add(rules[i].typo, rules[i].correction);
+        }
+        CHECK(rule_count == count, "%u rules indexed, %u added", rule_count, count);
+        uint8_t in_use = __builtin_popcount(lengths);
+
+        // Every pass types the same keys from the same state, the fastest of
+        // them per key leaves out the times the host preempted the test.
+        keyrecord_t record = {.event = {.type = KEY_EVENT, .pressed = true}};
+        for (uint8_t pass = 0; pass < BENCH_PASSES; pass++) {
+            bench_forget();
+            sim_host_clear();
+            for (uint32_t i = 0; i < BENCH_KEYS; i++) {
+                lookup_ns = probes = 0;
+                uint64_t t0        = now_ns();
+                bench_process(bench_keys[i], &record);
+                uint32_t ns   = now_ns() - t0;
+                call_ns[i]    = pass ? MIN(call_ns[i], ns) : ns;
+                lookups_ns[i] = pass ? MIN(lookups_ns[i], lookup_ns) : lookup_ns;
+                probes_max    = MAX(probes_max, probes);
+            }
+        }
+        printf("%5u %7u", count, in_use);
+        print_times("call", call_ns);
+        print_times("lookup", lookups_ns);
+        printf(" %6u\n", probes_max);
+        CHECK(probes_max <= AC_OVERLAY_MAX_PROBES * in_use, "%u rules: a keystroke read %u index slots, %u typo lengths in use allow %u", count, probes_max, in_use, AC_OVERLAY_MAX_PROBES * in_use);
+        if (counts[c] > total) break;
+    }
+    return sim_exit_code();
+}
@@ -0,0 +1,166 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// What the debounce settings do to bouncing switches: DEBOUNCE_TYPE in
+// ../rules.mk picks the stand-in's copy of the QMK algorithm, DEBOUNCE comes
+// from config.h. The copy is not checked against QMK here, only what the
+// chosen type and time do with it. Typed text must reach the host once per
+// key, each press on the scan that first sees contact and each release about
+// DEBOUNCE ms after the last bounce, also while a neighbouring key bounces in
+// a roll, which a global debounce such as QMK's default sym_defer_g fails.
+// The chatter is synthetic, seeded random bounce on every edge; there is no
+// recording of the board's switches. Without debounce the same input
+// chatters, and bounce lasting longer than DEBOUNCE is shown as well.
+
+#include <stdlib.h>
+#include "sim.h"
+#include "keymap_german.h"
+
+#ifdef SIM_DEBOUNCE_asym_eager_defer_pk
+#    define DEBOUNCE_NAME "eager"
+#else
+#    define DEBOUNCE_NAME "global"
+#endif
+
+static const char *text = "hallo welt wir tippen mit prellenden tasten ";
+// No key twice in a row, each is pressed again before the last one is up.
+static const char *rolled = "der fuchs springt ueber den hund ";
+
+#define MAX_EVENTS 1024
+
+typedef struct {
+    uint32_t time;
+    keypos_t key;
+    bool     pressed;
+} event_t;
+
+typedef struct {
+    keypos_t key;
+    uint32_t contact; // first contact of the press
+    uint32_t open;    // last bounce of the release
+} stroke_t;
+
+// Debounced key changes, sampled after every scan.
+static event_t  changes[MAX_EVENTS];
+static uint16_t change_count;
+static event_t  events[MAX_EVENTS];
+static uint16_t event_count;
+static stroke_t strokes[64];
+static uint8_t  stroke_count;
+
+static void add(uint32_t time, keypos_t key, bool pressed) {
+    if (event_count < MAX_EVENTS) events[event_count++] = (event_t){time, key, pressed};
+}
+
+// Contact changes for one edge: the switch toggles for up to `bounce` ms and
+// settles on `pressed`. Returns the time of the last change.
+static uint32_t edge(uint32_t time, keypos_t key, bool pressed, uint32_t bounce) {
+    uint32_t toggles = bounce ? rand() % (bounce + 1) & ~1u : 0;
+    for (uint32_t i = 0; i < toggles; i++) {
+        add(time++, key, i % 2 ? !pressed : pressed);
+    }
+    add(time, key, pressed);
+    return time;
+}
+
+static int by_time(const void *a, const void *b) {
+    const event_t *x = a, *y = b;
+    return (x->time > y->time) - (x->time < y->time);
+}
+
+// Keys `spacing` ms apart, each held 70 ms.
+static void type_bouncing(const char *text, uint32_t spacing, uint32_t bounce) {
+    uint32_t now   = 0;
+    uint32_t start = timer_now_us() / 1000;
+
+    event_count = stroke_count = 0;
+    for (const char *c = text; *c; c++, now += spacing) {
+        keypos_t key;
+        uint16_t keycode = *c == ' ' ? KC_SPC : *c == 'z' ? DE_Z : *c == 'y' ? DE_Y : KC_A + *c - 'a';
+        if (!sim_find_key(keycode, 0, &key)) continue;
+        edge(now, key, true, bounce);
+        strokes[stroke_count++] = (stroke_t){key, start + now, start + edge(now + 70, key, false, bounce)};
+    }
+    qsort(events, event_count, sizeof(event_t), by_time);
+
+    change_count = 0;
+    now          = 0;
+    for (uint16_t i = 0; now < events[event_count - 1].time + 500; now++) {
+        for (; i < event_count && events[i].time == now; i++) {
+            matrix_set_raw(events[i].key.row, events[i].key.col, events[i].pressed);
+        }
+        matrix_row_t before[MATRIX_ROWS];
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            before[row] = matrix_get_row(row);
+        }
+        sim_run(1);
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            matrix_row_t delta = before[row] ^ matrix_get_row(row);
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                if ((delta >> col & 1) && change_count < MAX_EVENTS) changes[change_count++] = (event_t){start + now, {col, row}, matrix_get_row(row) >> col & 1};
+            }
+        }
+    }
+}
+
+// Milliseconds from `time` to the first debounced change of `key` to
+// `pressed`, or -1.
+static int32_t latency(keypos_t key, uint32_t time, bool pressed) {
+    for (uint16_t i = 0; i < change_count; i++) {
+        if (changes[i].time >= time && KEYEQ(changes[i].key, key) && changes[i].pressed == pressed) return changes[i].time - time;
+    }
+    return -1;
+}
+
+typedef struct {
+    int32_t press_max;
+    int32_t release_min;
+    int32_t release_max;
+    bool    typed;
+} result_t;
+
+static result_t run(const char *name, const char *text, uint32_t spacing, bool debounce, uint32_t bounce) {
+    result_t result = {0, INT32_MAX, 0, false};
+
+    sim_debounce = debounce;
+    sim_reports_clear();
+    sim_host_clear();
+    type_bouncing(text, spacing, bounce);
+
+    for (uint8_t i = 0; i < stroke_count; i++) {
+        int32_t press      = latency(strokes[i].key, strokes[i].contact, true);
+        int32_t release    = latency(strokes[i].key, strokes[i].open, false);
+        result.press_max   = MAX(result.press_max, press);
+        result.release_min = MIN(result.release_min, release);
+        result.release_max = MAX(result.release_max, release);
+    }
+    result.typed = !strcmp(sim_host.text, text);
+    printf("%-8s %-8s %8u %8d %10d %10d %8d\n", name, spacing < 70 ? "rolled" : "single", bounce, result.press_max, result.release_min, result.release_max, (int32_t)strlen(sim_host.text) - (int32_t)strlen(text));
+    return result;
+}
+
+static void check(const char *text, uint32_t spacing, uint32_t bounce) {
+    result_t result = run(DEBOUNCE_NAME, text, spacing, true, bounce);
+
+    CHECK(result.typed, "bouncing for up to %u ms typed \"%s\"", bounce, sim_host.text);
+    CHECK(result.press_max == 0, "presses reported on the scan that sees contact, took up to %d ms", result.press_max);
+    // A bounce back restarts the count one scan before the contact opens
+    // again, so a release can come one ms early.
+    CHECK(result.release_min >= DEBOUNCE - 1 && result.release_max == DEBOUNCE, "releases reported DEBOUNCE ms after the last bounce, took %d to %d ms", result.release_min, result.release_max);
+}
+
+int main(void) {
+    sim_init();
+    sim_run(1000);
+    srand(1);
+
+    printf("%-8s %-8s %8s %8s %10s %10s %8s\n", "debounce", "keys", "bounce", "press ms", "release ms", "max", "extra");
+    check(text, 120, 0);
+    check(text, 120, 2);
+    check(text, 120, DEBOUNCE - 1);
+    // The next key comes down 2 ms before this one lets go, their bounce overlaps.
+    check(rolled, 68, DEBOUNCE - 1);
+    CHECK(!run("none", text, 120, false, DEBOUNCE - 1).typed, "without debounce the bounce shows up");
+    run(DEBOUNCE_NAME, text, 120, true, DEBOUNCE + 3);
+    return sim_exit_code();
+}
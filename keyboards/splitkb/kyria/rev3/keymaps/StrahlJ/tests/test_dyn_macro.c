@@ -0,0 +1,214 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Dynamic macros: a recording is written to flash once the keyboard is idle
+// or suspends, never while keys are processed. Playback must give the host
+// the recorded text in fewer reports than live typing, without a report
+// whose key order matters, and leave keys the user holds alone. A save cut
+// short by a power loss must load as the old recording, the new one or none.
+
+#include "sim.h"
+#include "keymap_german.h"
+#include "dyn_macro.h"
+#include "user_data.h"
+
+static const char *text = "Hallo Welt, wie geht es.";
+
+static keypos_t leader, arrow, shift;
+
+static bool last_report_has(uint8_t key) {
+    size_t              count;
+    const sim_report_t *reports = sim_reports(&count);
+    while (count--) {
+        if (reports[count].type != SIM_REPORT_KEYBOARD) continue;
+        for (uint8_t k = 0; k < KEYBOARD_REPORT_KEYS; k++) {
+            if (reports[count].keyboard.keys[k] == key) return true;
+        }
+        return false;
+    }
+    return false;
+}
+
+static bool last_report_empty(void) {
+    size_t              count;
+    const sim_report_t *reports = sim_reports(&count);
+    while (count--) {
+        if (reports[count].type != SIM_REPORT_KEYBOARD) continue;
+        for (uint8_t k = 0; k < KEYBOARD_REPORT_KEYS; k++) {
+            if (reports[count].keyboard.keys[k]) return false;
+        }
+        return !reports[count].keyboard.mods;
+    }
+    return true;
+}
+
+static size_t play(uint16_t keycode) {
+    sim_reports_clear();
+    sim_host_clear();
+    dyn_macro_command(keycode);
+    sim_run(10);
+    return sim_report_count(SIM_REPORT_KEYBOARD);
+}
+
+// What typing the macro live took.
+static size_t   live_reports;
+static uint32_t live_mods_with_keys;
+
+// Recorded with the leader sequences, the stop sequence runs inside
+// process_record_user().
+static void test_record(void) {
+    sim_tap(leader.row, leader.col, 40, 80);
+    sim_type("mr", 40, 80);
+    sim_run(LEADER_TIMEOUT + 100);
+    CHECK(dyn_macro_is_recording(), "leader M R starts recording");
+
+    sim_reports_clear();
+    sim_host_clear();
+    sim_type(text, 40, 80);
+    live_reports        = sim_report_count(SIM_REPORT_KEYBOARD);
+    live_mods_with_keys = sim_host.mods_with_keys;
+    CHECK(!strcmp(sim_host.text, text), "typed \"%s\" while recording", sim_host.text);
+
+    sim_flash_t before = sim_flash;
+    sim_tap(leader.row, leader.col, 40, 80);
+    sim_type("ms", 40, 80);
+    sim_run(LEADER_TIMEOUT + 100);
+    CHECK(!dyn_macro_is_recording(), "leader M S stops recording");
+    CHECK(sim_flash.writes == before.writes, "nothing written while the last keys are fresh");
+    sim_run(DYN_MACRO_SAVE_IDLE);
+    CHECK(sim_flash.writes > before.writes, "recording saved once idle");
+    CHECK(sim_flash.writes_in_keys == before.writes_in_keys, "%u writes during key processing", sim_flash.writes_in_keys - before.writes_in_keys);
+    printf("recorded %zu characters, %u bytes written, none while processing keys\n", strlen(text), sim_flash.bytes - before.bytes);
+}
+
+// One-shot shift reaches the host with the key it applies to, live as well
+// as played back; playback must not add to those reports.
+static void test_play(void) {
+    size_t reports = play(DM_PLY1);
+    printf("%-10s %8s %8s\n", "", "reports", "per char");
+    printf("%-10s %8zu %8.2f\n", "live", live_reports, (double)live_reports / strlen(text));
+    printf("%-10s %8zu %8.2f\n", "playback", reports, (double)reports / strlen(text));
+    CHECK(!strcmp(sim_host.text, text), "played back as \"%s\"", sim_host.text);
+    CHECK(sim_host.ambiguous == 0, "%u reports whose order the host may not keep", sim_host.ambiguous);
+    CHECK(sim_host.mods_with_keys <= live_mods_with_keys, "%u reports press keys and change modifiers, %u live", sim_host.mods_with_keys, live_mods_with_keys);
+    CHECK(reports < live_reports, "%zu reports, live typing took %zu", reports, live_reports);
+    CHECK(last_report_empty(), "nothing left pressed");
+}
+
+static void test_held_keys(void) {
+    // A held arrow key on the navigation layer stays down throughout.
+    layer_on(1);
+    sim_press(arrow.row, arrow.col);
+    sim_run(20);
+    play(DM_PLY1);
+    CHECK(!strcmp(sim_host.text, text), "played back as \"%s\" with Left held", sim_host.text);
+    CHECK(last_report_has(KC_LEFT), "held Left still pressed after playback");
+    sim_release(arrow.row, arrow.col);
+    sim_run(20);
+    layer_off(1);
+
+    // A held shift doesn't change the macro and is back afterwards.
+    sim_press(shift.row, shift.col);
+    sim_run(TAPPING_TERM + 50);
+    play(DM_PLY1);
+    CHECK(!strcmp(sim_host.text, text), "played back as \"%s\" with shift held", sim_host.text);
+    CHECK(get_mods() == MOD_BIT(KC_LSFT), "shift held again, mods 0x%02X", get_mods());
+    sim_release(shift.row, shift.col);
+    sim_run(20);
+}
+
+// Stopped with a key down, the recording holds that key; playback lets it go.
+// Suspending writes it right away.
+static void test_unfinished(void) {
+    keypos_t letter;
+    CHECK(sim_find_key(DE_A, 0, &letter), "A on the base layer");
+
+    dyn_macro_command(DM_REC2);
+    sim_press(letter.row, letter.col);
+    sim_run(100);
+    dyn_macro_command(DM_RSTP);
+    sim_release(letter.row, letter.col);
+    sim_run(20);
+
+    sim_flash_t before = sim_flash;
+    suspend_power_down();
+    suspend_wakeup_init();
+    CHECK(sim_flash.writes > before.writes, "recording saved on suspend");
+
+    play(DM_PLY2);
+    CHECK(!strcmp(sim_host.text, "a"), "played back as \"%s\"", sim_host.text);
+    CHECK(last_report_empty(), "the key held when recording stopped is released");
+}
+
+// Events a playback of slot 1 ran through process_record_user(), 0 when the
+// slot is empty. Garbage after a torn save may well type nothing.
+static uint32_t played_events(void) {
+    uint32_t before = sim_hooks[SIM_HOOK_PROCESS_RECORD].calls;
+    play(DM_PLY1);
+    return sim_hooks[SIM_HOOK_PROCESS_RECORD].calls - before;
+}
+
+static void record_shorter(const char *shorter) {
+    dyn_macro_command(DM_REC1);
+    sim_type(shorter, 40, 80);
+    dyn_macro_command(DM_RSTP);
+}
+
+// A shorter recording saved over a longer one, with power lost after every
+// number of writes the save makes, each write cut off after `tear` bytes as
+// well as whole. Slot 1 holds `text` from test_record().
+static void test_power_loss(void) {
+    static uint8_t        snapshot[USER_DATA_MACRO_SIZE];
+    static const uint32_t tears[] = {0, 1, 2, 3, 40, 1000};
+    static const char    *shorter = "Bis bald.";
+    uint32_t              runs = 0, old = 0, none = 0;
+    int32_t               budget;
+
+    memcpy(snapshot, sim_datablock() + USER_DATA_MACRO_OFFSET, sizeof(snapshot));
+    uint32_t old_events = played_events();
+    record_shorter(shorter);
+    dyn_macro_save();
+    uint32_t new_events = played_events();
+
+    for (budget = 0;; budget++) {
+        bool finished = false;
+        for (uint8_t t = 0; t < ARRAY_SIZE(tears); t++) {
+            memcpy(sim_datablock() + USER_DATA_MACRO_OFFSET, snapshot, sizeof(snapshot));
+            dyn_macro_init();
+            record_shorter(shorter);
+
+            sim_flash.budget = budget;
+            sim_flash.tear   = tears[t];
+            dyn_macro_save();
+            finished         = sim_flash.budget > 0;
+            sim_flash.budget = -1;
+            sim_flash.tear   = 0;
+            dyn_macro_init();
+
+            uint32_t events = played_events();
+            bool     is_old = events == old_events && !strcmp(sim_host.text, text);
+            bool     is_new = events == new_events && !strcmp(sim_host.text, shorter);
+            runs++;
+            old += is_old;
+            none += !events;
+            CHECK(is_old || is_new || !events, "power lost after %d writes, %u bytes into the next: %u events played back as \"%s\", %u old, %u new", budget, tears[t], events, sim_host.text, old_events, new_events);
+            CHECK(last_report_empty(), "power lost after %d writes, %u bytes into the next: keys left pressed", budget, tears[t]);
+        }
+        if (finished) break;
+    }
+    printf("power loss: %d writes per save, %u runs, %u old, %u empty\n", budget - 1, runs, old, none);
+}
+
+int main(void) {
+    sim_init();
+    sim_run(1000);
+
+    CHECK(sim_find_key(QK_LEADER, 0, &leader) && sim_find_key(KC_LEFT, 1, &arrow) && sim_find_key(OSM(MOD_LSFT), 0, &shift), "leader and shift on the base layer, Left on the nav layer");
+    dyn_macro_set_play_delay(0);
+    test_record();
+    test_play();
+    test_held_keys();
+    test_unfinished();
+    test_power_loss();
+    return sim_exit_code();
+}
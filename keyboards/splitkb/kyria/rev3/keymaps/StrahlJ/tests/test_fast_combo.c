@@ -0,0 +1,170 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The combo engine under rolled typing: how long each press waits before
+// the host sees it, what the engine adds to pre_process_record_user(), and
+// how often a roll across combo keys fires a combo by mistake. Each run is
+// repeated with the engine bypassed for comparison.
+
+#include "sim.h"
+#include "keymap_german.h"
+#include "fast_combo.h"
+
+// German prose, rolled: "sz" in "ausziehen" is the S+Z combo's keys in a row.
+static const char *text = "der schnelle braune fuchs springt ueber den faulen hund und zieht sich dann aus ausziehen ist anstrengend ";
+
+#define MAX_PRESSES 256
+
+typedef struct {
+    uint32_t time;
+    uint8_t  usage;
+    bool     combo_key; // part of some combo
+} press_t;
+
+static press_t presses[MAX_PRESSES];
+static uint8_t press_count;
+
+static uint16_t keycode_for(char c) {
+    return c == ' ' ? KC_SPC : c == 'y' ? DE_Y : c == 'z' ? DE_Z : KC_A + c - 'a';
+}
+
+static bool is_combo_key(uint16_t keycode) {
+    for (uint8_t combo = 0; combo < fast_combos_count; combo++) {
+        for (uint8_t i = 0; i < FAST_COMBO_MAX_KEYS; i++) {
+            if (fast_combos[combo].keys[i] == keycode) return true;
+        }
+    }
+    return false;
+}
+
+// Types `text` with each key held `hold` ms and the next one pressed `gap` ms
+// after it, so keys overlap when gap < hold.
+static void roll(uint32_t hold, uint32_t gap) {
+    keypos_t held[8];
+    uint32_t release[8];
+    uint8_t  held_count = 0;
+    uint32_t now        = 0;
+
+    press_count = 0;
+    for (const char *c = text; *c; c++) {
+        uint16_t keycode = keycode_for(*c);
+        keypos_t key;
+        if (!sim_find_key(keycode, 0, &key)) continue;
+
+        for (uint32_t t = 0; t < gap; t++, now++) {
+            for (uint8_t i = 0; i < held_count; i++) {
+                if (release[i] == now) {
+                    sim_release(held[i].row, held[i].col);
+                    held[i]    = held[--held_count];
+                    release[i] = release[held_count];
+                    i--;
+                }
+            }
+            sim_run(1);
+        }
+        // A doubled letter still held is let go first.
+        for (uint8_t i = 0; i < held_count; i++) {
+            if (KEYEQ(held[i], key)) {
+                sim_release(key.row, key.col);
+                held[i]    = held[--held_count];
+                release[i] = release[held_count];
+                sim_run(1);
+                now++;
+                break;
+            }
+        }
+        presses[press_count++] = (press_t){(uint32_t)(timer_now_us() / 1000), keycode, is_combo_key(keycode)};
+        sim_press(key.row, key.col);
+        held[held_count]      = key;
+        release[held_count++] = now + hold;
+    }
+    while (held_count) {
+        for (uint8_t i = 0; i < held_count; i++) {
+            if (release[i] <= now) {
+                sim_release(held[i].row, held[i].col);
+                held[i]    = held[--held_count];
+                release[i] = release[held_count];
+                i--;
+            }
+        }
+        sim_run(1);
+        now++;
+    }
+    sim_run(500);
+}
+
+static bool report_has(const report_keyboard_t *report, uint8_t usage) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == usage) return true;
+    }
+    return false;
+}
+
+// Milliseconds from each press to the report that first shows it.
+static void latencies(uint32_t *sum, uint32_t *max, uint32_t *count, bool combo_keys) {
+    size_t              report_count;
+    const sim_report_t *reports = sim_reports(&report_count);
+
+    *sum = *max = *count = 0;
+    for (uint8_t p = 0; p < press_count; p++) {
+        if (presses[p].combo_key != combo_keys) continue;
+        bool before = false;
+        for (size_t r = 0; r < report_count; r++) {
+            if (reports[r].type != SIM_REPORT_KEYBOARD) continue;
+            bool now = report_has(&reports[r].keyboard, presses[p].usage);
+            if (reports[r].time >= presses[p].time && now && !before) {
+                uint32_t latency = reports[r].time - presses[p].time;
+                *sum += latency;
+                *max = MAX(*max, latency);
+                (*count)++;
+                break;
+            }
+            before = now;
+        }
+    }
+}
+
+static uint32_t mistyped(void) {
+    uint32_t errors = 0;
+    size_t   length = strlen(text);
+    for (size_t i = 0; i < length; i++) {
+        errors += sim_host.text[i] != text[i];
+    }
+    return errors + (strlen(sim_host.text) != length);
+}
+
+static void run(const char *engine, uint32_t hold, uint32_t gap, bool check) {
+    sim_reports_clear();
+    sim_host_clear();
+    memset(&sim_hooks[SIM_HOOK_PRE_PROCESS_RECORD], 0, sizeof(sim_hook_stat_t));
+    roll(hold, gap);
+
+    uint32_t sum, max, count, combo_sum, combo_max, combo_count;
+    latencies(&sum, &max, &count, false);
+    latencies(&combo_sum, &combo_max, &combo_count, true);
+    sim_hook_stat_t *hook = &sim_hooks[SIM_HOOK_PRE_PROCESS_RECORD];
+    printf("%-8s %4u/%-4u %10.2f %8u %10.2f %8u %10llu %9u\n", engine, hold, gap, count ? (double)sum / count : 0, max, combo_count ? (double)combo_sum / combo_count : 0, combo_max, hook->calls ? (unsigned long long)(hook->total_ns / hook->calls) : 0, mistyped());
+    if (check) {
+        CHECK(max == 0, "keys outside any combo are sent on the scan they are pressed in, waited up to %u ms", max);
+        CHECK(combo_max <= COMBO_TERM, "combo keys wait at most COMBO_TERM, waited %u ms", combo_max);
+    }
+}
+
+int main(void) {
+    static const uint32_t timings[][2] = {{80, 120}, {90, 60}, {100, 40}, {80, 25}};
+
+    sim_init();
+    sim_run(1000);
+
+    printf("%-8s %9s %10s %8s %10s %8s %10s %9s\n", "engine", "hold/gap", "other avg", "max ms", "combo avg", "max ms", "pre ns", "mistyped");
+    for (uint8_t i = 0; i < ARRAY_SIZE(timings); i++) {
+        run("combos", timings[i][0], timings[i][1], true);
+    }
+    // Combos only trigger on their layer; one that is never active bypasses
+    // the engine after its layer check.
+    fast_combo_init(MAX_LAYER - 1);
+    for (uint8_t i = 0; i < ARRAY_SIZE(timings); i++) {
+        run("bypass", timings[i][0], timings[i][1], false);
+    }
+    return sim_exit_code();
+}
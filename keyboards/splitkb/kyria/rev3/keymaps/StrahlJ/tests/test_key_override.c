@@ -0,0 +1,224 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Key overrides against QMK's semantics, then the cost of the lookup as the
+// rule table grows. The benchmark builds a second copy of the module, renamed,
+// on generated tables, and times it against the linear scan QMK's own key
+// overrides do for every event.
+
+#include <stdlib.h>
+#include <time.h>
+#include "sim.h"
+#include "keymap_german.h"
+
+// The table and its length become lvalues the benchmark can change.
+#define key_override_rules (*bench_rules)
+#define key_override_rules_count (*bench_rules_count)
+#define key_override_table_init bench_table_init
+#define process_key_override_table bench_process
+#define KEY_OVERRIDE_TABLE_MAX 250
+#include "../key_override_table.c"
+
+static keypos_t shift, bksp, letter;
+
+static bool report_has(const report_keyboard_t *report, uint8_t key) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == key) return true;
+    }
+    return false;
+}
+
+// Mods sent with the first report that presses `key`, -1 if none does.
+static int pressed_with(uint8_t key) {
+    size_t              count;
+    const sim_report_t *reports = sim_reports(&count);
+    bool                before  = false;
+
+    for (size_t i = 0; i < count; i++) {
+        if (reports[i].type != SIM_REPORT_KEYBOARD) continue;
+        bool now = report_has(&reports[i].keyboard, key);
+        if (now && !before) return reports[i].keyboard.mods;
+        before = now;
+    }
+    return -1;
+}
+
+// Whether the last report holds `key`.
+static bool held(uint8_t key) {
+    size_t              count;
+    const sim_report_t *reports = sim_reports(&count);
+
+    while (count--) {
+        if (reports[count].type == SIM_REPORT_KEYBOARD) return report_has(&reports[count].keyboard, key);
+    }
+    return false;
+}
+
+static void start(void) {
+    sim_run(500);
+    sim_reports_clear();
+    sim_host_clear();
+}
+
+// Held past the tapping term, the one-shot shift is a plain shift.
+static void hold_shift(void) {
+    sim_press(shift.row, shift.col);
+    sim_run(TAPPING_TERM + 50);
+}
+
+static void test_shift_then_bksp(void) {
+    start();
+    hold_shift();
+    sim_tap(bksp.row, bksp.col, 40, 40);
+    CHECK(pressed_with(KC_DEL) == 0, "Shift+Bksp sends Delete without shift, got mods %d", pressed_with(KC_DEL));
+    CHECK(pressed_with(KC_BSPC) < 0, "Backspace not sent");
+    CHECK(get_mods() == MOD_BIT(KC_LSFT), "shift back while held, got mods 0x%02X", get_mods());
+    sim_release(shift.row, shift.col);
+    sim_run(50);
+    CHECK(!get_mods(), "no mods left, got 0x%02X", get_mods());
+}
+
+static void test_bksp_then_shift(void) {
+    start();
+    sim_press(bksp.row, bksp.col);
+    sim_run(50);
+    hold_shift();
+    CHECK(pressed_with(KC_BSPC) == 0, "Backspace sent first");
+    CHECK(pressed_with(KC_DEL) == 0, "Shift pressed after Bksp still sends Delete");
+    CHECK(!held(KC_BSPC) && held(KC_DEL), "Backspace replaced by Delete");
+
+    // Letting go of shift ends the override, the held Bksp is pressed again.
+    sim_release(shift.row, shift.col);
+    sim_run(20);
+    CHECK(!held(KC_DEL) && held(KC_BSPC), "Backspace again once shift is up");
+    sim_release(bksp.row, bksp.col);
+    sim_run(50);
+    CHECK(!held(KC_BSPC), "Backspace released");
+}
+
+static void test_other_key_gets_mods(void) {
+    start();
+    hold_shift();
+    sim_press(bksp.row, bksp.col);
+    sim_run(40);
+    sim_tap(letter.row, letter.col, 40, 40);
+    CHECK(!strcmp(sim_host.text, "A"), "shift held through the override types \"A\", got \"%s\"", sim_host.text);
+    CHECK(!held(KC_DEL), "Delete released by the other key");
+    sim_release(bksp.row, bksp.col);
+    sim_run(40);
+
+    // A second override starts right away.
+    sim_reports_clear();
+    sim_tap(bksp.row, bksp.col, 40, 40);
+    CHECK(pressed_with(KC_DEL) == 0, "second Shift+Bksp sends Delete");
+    sim_release(shift.row, shift.col);
+    sim_run(50);
+}
+
+static void test_oneshot_shift(void) {
+    start();
+    sim_tap(shift.row, shift.col, 30, 50);
+    sim_tap(bksp.row, bksp.col, 40, 40);
+    sim_tap(letter.row, letter.col, 40, 40);
+    CHECK(pressed_with(KC_DEL) == 0, "one-shot shift + Bksp sends Delete");
+    CHECK(!strcmp(sim_host.text, "a"), "the one-shot shift is used up, got \"%s\"", sim_host.text);
+}
+
+// Benchmark.
+
+#define BENCH_MAX_RULES 240
+#define BENCH_EVENTS 4096
+#define BENCH_ROUNDS 500
+
+static key_override_rule_t bench_table[BENCH_MAX_RULES];
+static uint8_t             bench_count;
+const key_override_rule_t (*bench_rules)[]      = (const key_override_rule_t (*)[])&bench_table;
+const uint8_t             *bench_rules_count    = &bench_count;
+
+typedef struct {
+    uint16_t keycode;
+    uint8_t  mods;
+} bench_event_t;
+
+static bench_event_t bench_events[BENCH_EVENTS];
+
+static const key_override_rule_t *linear_lookup(uint8_t count, uint16_t keycode, uint8_t mods) {
+    uint8_t folded = MODS_FOLD(mods);
+    for (uint8_t i = 0; i < count; i++) {
+        const key_override_rule_t *rule         = &bench_table[i];
+        uint8_t                    trigger_mods = MODS_FOLD(rule->trigger_mods);
+        if (rule->trigger == keycode && (folded & trigger_mods) == trigger_mods) return rule;
+    }
+    return NULL;
+}
+
+// What process_key_override_table() does to find the rule for a press.
+static const key_override_rule_t *indexed_lookup(uint16_t keycode, uint8_t mods) {
+    if (keycode > QK_BASIC_MAX || !first_rule[keycode]) return NULL;
+    return find_rule(keycode, mods);
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void bench(void) {
+    static const uint8_t mods_choices[] = {0, 0, 0, 0, 0, 0, 0, MOD_BIT(KC_LSFT), MOD_BIT(KC_RSFT), MOD_BIT(KC_LCTL)};
+    static const uint8_t rule_mods[]    = {MOD_MASK_SHIFT, MOD_MASK_CTRL, MOD_MASK_ALT, MOD_MASK_GUI, MOD_MASK_CS, MOD_MASK_SHIFT | MOD_MASK_ALT};
+    static const uint8_t counts[]       = {6, 24, 48, 96, 192, 240};
+
+    // Rules on the 96 keycodes KC_A..KC_KP_DOT the events are drawn from, so
+    // with more rules more of the events hit a chain.
+    for (uint8_t i = 0; i < BENCH_MAX_RULES; i++) {
+        bench_table[i] = (key_override_rule_t)ko_rule(rule_mods[i / 96 % ARRAY_SIZE(rule_mods)], KC_A + (i * 37) % 96, KC_F1 + i % 12);
+    }
+    srand(1);
+    for (uint16_t i = 0; i < BENCH_EVENTS; i++) {
+        bench_events[i].keycode = KC_A + rand() % 96;
+        bench_events[i].mods    = mods_choices[rand() % ARRAY_SIZE(mods_choices)];
+    }
+
+    printf("%6s %12s %12s %8s\n", "rules", "indexed ns", "linear ns", "hits");
+    for (uint8_t c = 0; c < ARRAY_SIZE(counts); c++) {
+        bench_count = counts[c];
+        bench_table_init();
+
+        uint32_t hits = 0;
+        for (uint16_t i = 0; i < BENCH_EVENTS; i++) {
+            const key_override_rule_t *indexed = indexed_lookup(bench_events[i].keycode, bench_events[i].mods);
+            CHECK(indexed == linear_lookup(counts[c], bench_events[i].keycode, bench_events[i].mods), "index and scan agree on keycode 0x%02X mods 0x%02X with %u rules", bench_events[i].keycode, bench_events[i].mods, counts[c]);
+            hits += indexed != NULL;
+        }
+
+        uintptr_t volatile sink = 0;
+        uint64_t           t0   = now_ns();
+        for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+            for (uint16_t i = 0; i < BENCH_EVENTS; i++) {
+                sink += (uintptr_t)indexed_lookup(bench_events[i].keycode, bench_events[i].mods);
+            }
+        }
+        uint64_t t1 = now_ns();
+        for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+            for (uint16_t i = 0; i < BENCH_EVENTS; i++) {
+                sink += (uintptr_t)linear_lookup(counts[c], bench_events[i].keycode, bench_events[i].mods);
+            }
+        }
+        uint64_t t2     = now_ns();
+        double   events = (double)BENCH_ROUNDS * BENCH_EVENTS;
+        printf("%6u %12.2f %12.2f %7.1f%%\n", counts[c], (t1 - t0) / events, (t2 - t1) / events, 100.0 * hits / BENCH_EVENTS);
+    }
+}
+
+int main(void) {
+    sim_init();
+
+    CHECK(sim_find_key(OSM(MOD_LSFT), 0, &shift) && sim_find_key(KC_BSPC, 0, &bksp) && sim_find_key(DE_A, 0, &letter), "shift, Bksp and A on the base layer");
+    test_shift_then_bksp();
+    test_bksp_then_shift();
+    test_other_key_gets_mods();
+    test_oneshot_shift();
+    bench();
+    return sim_exit_code();
+}
@@ -0,0 +1,62 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// End to end checks of the base layer features through the host's eyes.
+
+#include "sim.h"
+#include "keymap_german.h"
+
+static void expect_text(const char *expected) {
+    CHECK(!strcmp(sim_host.text, expected), "typed \"%s\", expected \"%s\"", sim_host.text, expected);
+    sim_host_clear();
+}
+
+static void test_typing(void) {
+    sim_type("hallo welt", 40, 80);
+    expect_text("hallo welt");
+
+    sim_type("Zeile eins\nzwei", 40, 80);
+    expect_text("Zeile eins\nzwei");
+}
+
+static void test_leader(void) {
+    sim_tap_keycode(QK_LEAD, 0, 30, 50);
+    sim_tap_keycode(DE_L, 0, 30, 50);
+    sim_tap_keycode(DE_K, 0, 30, 500);
+    expect_text("loadkeys de-latin1");
+
+    sim_tap_keycode(QK_LEAD, 0, 30, 50);
+    sim_tap_keycode(DE_S, 0, 30, 50);
+    sim_tap_keycode(DE_S, 0, 30, 500);
+    expect_text("🐍");
+}
+
+static void test_autocorrect(void) {
+    sim_type("ein fitler ", 40, 80);
+    expect_text("ein filter ");
+}
+
+static void test_combo(void) {
+    keypos_t s, z;
+    CHECK(sim_find_key(DE_S, 0, &s) && sim_find_key(DE_Z, 0, &z), "S and Z on the base layer");
+
+    sim_press(s.row, s.col);
+    sim_run(10);
+    sim_press(z.row, z.col);
+    sim_run(40);
+    sim_release(s.row, s.col);
+    sim_release(z.row, z.col);
+    sim_run(100);
+    expect_text("ß");
+}
+
+int main(void) {
+    sim_init();
+    sim_run(1000);
+
+    test_typing();
+    test_leader();
+    test_autocorrect();
+    test_combo();
+    return sim_exit_code();
+}
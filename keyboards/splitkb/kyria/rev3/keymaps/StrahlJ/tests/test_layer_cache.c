@@ -0,0 +1,172 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// layer_cache.c against an uncached walk over keymaps[]: after every layer
+// change the keys are driven through (momentary, one-shot and toggled layers,
+// layer lock, caps word and the default layer) each key must resolve to the
+// keycode QMK's own transparent walk finds, and every layer must answer what
+// keymaps[] holds. A layer change that is not invalidated leaves entries on
+// layers the walk no longer ends on, which read keymaps[] on every lookup
+// from then on; so once all keys were looked up, a second walk over them
+// must not read keymaps[] at all.
+
+#include "sim.h"
+#include "keymap_german.h"
+#include "keymap_introspection.h"
+
+enum { _QWERTZ, _NAV, _SYM, _BRACS, _FUNCTION, _GAMING, _MOUSE };
+
+static uint16_t uncached(uint8_t row, uint8_t col) {
+    layer_state_t layers = layer_state | default_layer_state;
+
+    for (int8_t layer = MAX_LAYER - 1; layer >= 0; layer--) {
+        if (!(layers & ((layer_state_t)1 << layer)) || layer >= keymap_layer_count()) continue;
+        uint16_t keycode = keycode_at_keymap_location(layer, row, col);
+        if (keycode != KC_TRNS) return keycode;
+    }
+    return keycode_at_keymap_location(0, row, col);
+}
+
+// Compares every key, which also reads them all so the next change has
+// entries to invalidate.
+static uint16_t mismatches(const char *step) {
+    uint16_t mismatches = 0;
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            keypos_t key    = {.row = row, .col = col};
+            uint16_t cached = keymap_key_to_keycode(layer_switch_get_layer(key), key);
+            uint16_t walked = uncached(row, col);
+            if (cached != walked) {
+                if (!mismatches) printf("%s: [%u, %u] cached 0x%04X, keymaps[] 0x%04X\n", step, row, col, cached, walked);
+                mismatches++;
+            }
+            for (uint8_t layer = 0; layer < keymap_layer_count(); layer++) {
+                if (keymap_key_to_keycode(layer, key) != keycode_at_keymap_location(layer, row, col)) mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+// keymaps[] reads of a walk over every key, as QMK does it on a key press.
+static uint32_t walk_reads(void) {
+    uint32_t before = sim_keymap_reads;
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            keypos_t key = {.row = row, .col = col};
+            keymap_key_to_keycode(layer_switch_get_layer(key), key);
+        }
+    }
+    return sim_keymap_reads - before;
+}
+
+static void compare(const char *step) {
+    uint16_t count = mismatches(step);
+    uint32_t reads = walk_reads();
+
+    printf("%-28s layers 0x%04X default 0x%04X  %3u reads  %s\n", step, (unsigned)layer_state, (unsigned)default_layer_state, reads, count ? "MISMATCH" : "ok");
+    CHECK(count == 0, "%s: %u lookups differ from keymaps[]", step, count);
+    CHECK(reads == 0, "%s: the second walk read keymaps[] %u times", step, reads);
+}
+
+static keypos_t find(uint16_t keycode, uint8_t layer) {
+    keypos_t key = {0};
+    CHECK(sim_find_key(keycode, layer, &key), "keycode 0x%04X on layer %u", keycode, layer);
+    return key;
+}
+
+static void test_momentary_and_lock(void) {
+    keypos_t nav  = find(MO(_NAV), _QWERTZ);
+    keypos_t lock = find(QK_LLCK, _NAV);
+
+    compare("base");
+    sim_press(nav.row, nav.col);
+    sim_run(50);
+    compare("NAV held");
+    sim_tap(lock.row, lock.col, 30, 50);
+    sim_release(nav.row, nav.col);
+    sim_run(50);
+    CHECK(layer_state_is(_NAV), "NAV locked");
+    compare("NAV locked, key released");
+    sim_tap(lock.row, lock.col, 30, 50);
+    CHECK(!layer_state_is(_NAV), "NAV unlocked");
+    compare("NAV unlocked");
+}
+
+static void test_one_shot(void) {
+    keypos_t sym = find(OSL(_SYM), _QWERTZ);
+
+    sim_tap(sym.row, sym.col, 30, 50);
+    CHECK(layer_state_is(_SYM), "one-shot SYM on");
+    compare("one-shot SYM");
+    sim_tap_keycode(DE_1, _SYM, 30, 50);
+    CHECK(!layer_state_is(_SYM), "one-shot SYM used up");
+    compare("one-shot SYM used");
+}
+
+static void test_toggle(void) {
+    keypos_t nav    = find(MO(_NAV), _QWERTZ);
+    keypos_t gaming = find(TG(_GAMING), _NAV);
+
+    for (uint8_t i = 0; i < 2; i++) {
+        sim_press(nav.row, nav.col);
+        sim_run(50);
+        sim_tap(gaming.row, gaming.col, 30, 50);
+        sim_release(nav.row, nav.col);
+        sim_run(50);
+        compare(i ? "GAMING toggled off" : "GAMING toggled on");
+    }
+}
+
+static void test_caps_word(void) {
+    caps_word_on();
+    compare("caps word on");
+    sim_type("ab", 30, 50);
+    caps_word_off();
+    compare("caps word off");
+}
+
+static void test_default_layer(void) {
+    default_layer_set((layer_state_t)1 << _GAMING);
+    compare("default GAMING");
+    keypos_t nav = find(MO(_NAV), _QWERTZ);
+    sim_press(nav.row, nav.col);
+    sim_run(50);
+    compare("default GAMING, NAV held");
+    sim_release(nav.row, nav.col);
+    sim_run(50);
+    default_layer_set((layer_state_t)1 << _QWERTZ);
+    compare("default QWERTZ");
+}
+
+// The generation counter is a byte; more changes than it holds must not make
+// an old entry look current.
+static void test_generation_wrap(void) {
+    uint32_t count = 0;
+    uint32_t reads = 0;
+
+    for (uint16_t i = 0; i < 600; i++) {
+        layer_invert(_MOUSE);
+        count += mismatches("MOUSE inverted");
+        reads += walk_reads();
+    }
+    CHECK(count == 0, "%u lookups differ from keymaps[] over 600 layer changes", count);
+    CHECK(reads == 0, "second walks read keymaps[] %u times over 600 layer changes", reads);
+    layer_clear();
+    compare("layers cleared");
+}
+
+int main(void) {
+    sim_init();
+    sim_run(1000);
+
+    test_momentary_and_lock();
+    test_one_shot();
+    test_toggle();
+    test_caps_word();
+    test_default_layer();
+    test_generation_wrap();
+    return sim_exit_code();
+}
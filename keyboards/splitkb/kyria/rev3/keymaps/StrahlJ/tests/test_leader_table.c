@@ -0,0 +1,101 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// leader_table.c against QMK's leader buffer: for every session the trie must
+// resolve the sequence that leader_sequence_*_keys() would find in the buffer
+// QMK ends with, also when a sixth key overflows it. A copy of the module runs
+// on its own table next to the keymap's, which has no five key sequence.
+
+#include "sim.h"
+#include "keymap_german.h"
+
+#define leader_sequences test_sequences
+#define leader_sequences_count test_sequences_count
+#define leader_table_init test_table_init
+#define leader_table_start test_table_start
+#define leader_table_end test_table_end
+#define leader_table_record test_table_record
+#include "../leader_table.c"
+
+static int fired;
+
+static void fired_0(void) {
+    fired = 0;
+}
+static void fired_1(void) {
+    fired = 1;
+}
+static void fired_2(void) {
+    fired = 2;
+}
+
+// None of these start like a sequence of the keymap.
+const leader_sequence_t test_sequences[] = {
+    {LEADER_KEYS(DE_Q, DE_W, DE_E), LEADER_CALL(fired_0)},
+    {LEADER_KEYS(DE_Q, DE_W, DE_E, DE_R, DE_T), LEADER_CALL(fired_1)},
+    {LEADER_KEYS(DE_Q, DE_X), LEADER_CALL(fired_2)},
+};
+const uint8_t test_sequences_count = ARRAY_SIZE(test_sequences);
+
+// Taps the leader key and `keys`, feeding the copy the way process_record_user()
+// feeds the keymap's table, ahead of process_leader(). Returns what the copy
+// fired and, in `qmk`, what the buffer QMK ends with matches.
+static int run(const uint16_t *keys, uint8_t count, int *qmk) {
+    fired = -1;
+    sim_host_clear();
+    CHECK(sim_tap_keycode(QK_LEAD, 0, 30, 50), "leader key on the base layer");
+    test_table_start();
+    for (uint8_t i = 0; i < count; i++) {
+        keyrecord_t record = {.event = MAKE_KEYEVENT(0, 0, true)};
+        test_table_record(keys[i], &record);
+        CHECK(sim_tap_keycode(keys[i], 0, 30, 50), "key %u of the sequence on the base layer", i);
+    }
+    sim_run(LEADER_TIMEOUT + 100);
+    CHECK(!leader_sequence_active(), "the sequence ended");
+    test_table_end();
+
+    *qmk = -1;
+    for (uint8_t s = 0; s < test_sequences_count; s++) {
+        uint8_t length = 0;
+        while (length < LEADER_TABLE_MAX_KEYS && test_sequences[s].keys[length] != KC_NO) length++;
+        if (leader_sequence_is(test_sequences[s].keys, length)) *qmk = s;
+    }
+    return fired;
+}
+
+static void test_sessions(void) {
+    static const struct {
+        const char *name;
+        uint16_t    keys[7];
+        uint8_t     count;
+        int         expected;
+        const char *typed;
+    } sessions[] = {
+        {"Q W E", {DE_Q, DE_W, DE_E}, 3, 0, ""},
+        {"Q W E R T", {DE_Q, DE_W, DE_E, DE_R, DE_T}, 5, 1, ""},
+        {"Q W E R T, then Y overflows", {DE_Q, DE_W, DE_E, DE_R, DE_T, DE_Y}, 6, 1, "y"},
+        {"Q W E R T, then Y A", {DE_Q, DE_W, DE_E, DE_R, DE_T, DE_Y, DE_A}, 7, 1, "ya"},
+        {"Q W E R Y, then T overflows", {DE_Q, DE_W, DE_E, DE_R, DE_Y, DE_T}, 6, -1, "t"},
+        {"Q X", {DE_Q, DE_X}, 2, 2, ""},
+        {"Q W", {DE_Q, DE_W}, 2, -1, ""},
+    };
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(sessions); i++) {
+        int qmk;
+        int trie = run(sessions[i].keys, sessions[i].count, &qmk);
+        printf("%-30s qmk %2d trie %2d typed \"%s\"\n", sessions[i].name, qmk, trie, sim_host.text);
+
+        CHECK(qmk == sessions[i].expected, "%s: QMK's buffer matches sequence %d, expected %d", sessions[i].name, qmk, sessions[i].expected);
+        CHECK(trie == qmk, "%s: the trie fired %d, QMK's buffer matches %d", sessions[i].name, trie, qmk);
+        CHECK(!strcmp(sim_host.text, sessions[i].typed), "%s: typed \"%s\", expected \"%s\"", sessions[i].name, sim_host.text, sessions[i].typed);
+    }
+}
+
+int main(void) {
+    sim_init();
+    sim_run(1000);
+
+    test_table_init();
+    test_sessions();
+    return sim_exit_code();
+}
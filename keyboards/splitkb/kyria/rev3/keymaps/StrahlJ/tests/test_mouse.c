@@ -0,0 +1,142 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Cursor trajectories from mouse_engine.c as the host sees them: the
+// position while a direction is held, sampled every 100 ms, against the speed
+// curve in mouse_engine.h, then the constant speeds of MS_ACL0..MS_ACL2,
+// diagonals and the wheel.
+
+#include <math.h>
+#include <stdlib.h>
+#include "sim.h"
+#include "mouse_engine.h"
+
+static uint8_t mouse_layer;
+
+static keypos_t key_for(uint16_t keycode) {
+    keypos_t key = {0};
+    CHECK(sim_find_key(keycode, mouse_layer, &key), "keycode 0x%04X on the mouse layer", keycode);
+    return key;
+}
+
+static void press(uint16_t keycode) {
+    keypos_t key = key_for(keycode);
+    sim_press(key.row, key.col);
+}
+
+static void release(uint16_t keycode) {
+    keypos_t key = key_for(keycode);
+    sim_release(key.row, key.col);
+}
+
+// The speed curve: pixels per second `ms` after the press.
+static double curve(uint32_t ms) {
+    if (ms >= MOUSE_ACCEL_TIME) return MOUSE_SPEED_MAX;
+    double ramp = (double)ms / MOUSE_ACCEL_TIME;
+#if MOUSE_CURVE == MOUSE_CURVE_QUADRATIC
+    ramp *= ramp;
+#endif
+    return MOUSE_SPEED_MIN + (MOUSE_SPEED_MAX - MOUSE_SPEED_MIN) * ramp;
+}
+
+// Where the curve puts the cursor `ms` after the press, the pixel of the
+// press itself included.
+static double expected(uint32_t ms) {
+    double x = 1;
+    for (uint32_t t = 0; t < ms; t++) {
+        x += curve(t) / 1000;
+    }
+    return x;
+}
+
+static void test_curve(void) {
+    sim_host_clear();
+    press(MS_RGHT);
+    printf("%6s %8s %8s %8s\n", "ms", "x", "curve", "px/s");
+    int32_t last = 0;
+    for (uint32_t ms = 100; ms <= 1500; ms += 100) {
+        sim_run(100);
+        double want = expected(ms);
+        printf("%6u %8d %8.0f %8d\n", ms, sim_host.x, want, (sim_host.x - last) * 10);
+        // The cursor trails the curve: the press is processed on a later scan,
+        // motion goes out once per report interval and the fraction of a
+        // pixel stays behind.
+        double early = expected(ms - 2 - MOUSE_REPORT_INTERVAL) - 1;
+        CHECK(sim_host.x >= early && sim_host.x <= want, "%u ms: x %d, curve %.0f to %.0f", ms, sim_host.x, early, want);
+        last = sim_host.x;
+    }
+    CHECK(sim_host.y == 0, "straight right, y %d", sim_host.y);
+    release(MS_RGHT);
+    sim_run(100);
+}
+
+// Speed over one second of `direction` held with `speed_key`, in px/s.
+static double held_speed(uint16_t speed_key, uint16_t direction, uint16_t other) {
+    if (speed_key) press(speed_key);
+    sim_run(10);
+    sim_host_clear();
+    press(direction);
+    if (other) press(other);
+    sim_run(1000);
+    release(direction);
+    if (other) release(other);
+    if (speed_key) release(speed_key);
+    sim_run(100);
+    return sqrt((double)sim_host.x * sim_host.x + (double)sim_host.y * sim_host.y);
+}
+
+static void test_speed_keys(void) {
+    static const struct {
+        uint16_t    keycode;
+        const char *name;
+        double      speed;
+    } keys[] = {
+        {MS_ACL0, "MS_ACL0", MOUSE_PRECISION_SPEED},
+        {MS_ACL1, "MS_ACL1", MOUSE_SPEED_MID},
+        {MS_ACL2, "MS_ACL2", MOUSE_SPEED_MAX},
+    };
+
+    printf("%-8s %8s %8s\n", "key", "px/s", "wanted");
+    for (uint8_t i = 0; i < ARRAY_SIZE(keys); i++) {
+        double speed = held_speed(keys[i].keycode, MS_DOWN, 0);
+        printf("%-8s %8.0f %8.0f\n", keys[i].name, speed, keys[i].speed);
+        CHECK(fabs(speed - keys[i].speed) <= keys[i].speed * 0.02 + 2, "%s moves at %.0f px/s, wanted %.0f", keys[i].name, speed, keys[i].speed);
+    }
+
+    // With two held the slower one counts.
+    press(MS_ACL0);
+    double speed = held_speed(MS_ACL2, MS_DOWN, 0);
+    release(MS_ACL0);
+    CHECK(fabs(speed - MOUSE_PRECISION_SPEED) <= MOUSE_PRECISION_SPEED * 0.02 + 2, "MS_ACL0 with MS_ACL2 moves at %.0f px/s", speed);
+
+    double straight = held_speed(MS_ACL2, MS_UP, 0);
+    double diagonal = held_speed(MS_ACL2, MS_UP, MS_LEFT);
+    printf("%-8s %8.0f %8.0f\n", "diagonal", diagonal, straight);
+    CHECK(fabs(diagonal - straight) <= straight * 0.02, "diagonal %.0f px/s, straight %.0f", diagonal, straight);
+}
+
+static void test_wheel(void) {
+    sim_host_clear();
+    press(MS_WHLD);
+    sim_run(1000);
+    release(MS_WHLD);
+    sim_run(100);
+    printf("%-8s %8d %8d\n", "wheel", -sim_host.wheel_v, MOUSE_WHEEL_SPEED + 1);
+    CHECK(abs(-sim_host.wheel_v - (MOUSE_WHEEL_SPEED + 1)) <= 1, "one second of wheel down scrolled %d steps", -sim_host.wheel_v);
+}
+
+int main(void) {
+    keypos_t key;
+
+    sim_init();
+    sim_run(1000);
+    for (mouse_layer = 0; mouse_layer < MAX_LAYER && !sim_find_key(MS_RGHT, mouse_layer, &key); mouse_layer++) {
+    }
+    CHECK(mouse_layer < MAX_LAYER, "a layer with the mouse keys");
+    layer_on(mouse_layer);
+
+    test_curve();
+    test_speed_keys();
+    test_wheel();
+    return sim_exit_code();
+}
@@ -0,0 +1,152 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// What the status OLED costs the main loop. Composition is timed per call of
+// oled_task_user() next to key processing, and the OLED buffer bytes it
+// changes are what QMK's oled_task() then sends over I2C. That transfer runs
+// in QMK's keyboard_task() after oled_task_user() returns; the keymap can make
+// it smaller but can't move it off the core that scans the matrix.
+//
+// Then the slave: the bytes per second status_sync.c puts on the wire while
+// typing and idle, framing included, that a leader sequence sends nothing the
+// mirror doesn't show, and the mirrored status drawn next to the logo without
+// touching it.
+
+#include "sim.h"
+#include "keymap_german.h"
+#include "bitmap_rle.h"
+#include "kyria_logo.h"
+#include "raw_hid_commands.h"
+#include "status_sync.h"
+
+static const char *text = "der schnelle braune fuchs springt ueber den faulen hund ";
+
+static bool text_at(uint8_t col, uint8_t line, const char *expected) {
+    for (uint8_t i = 0; expected[i]; i++) {
+        if (sim_oled_char(col + i, line) != expected[i]) return false;
+    }
+    return true;
+}
+
+static void reset_hooks(void) {
+    memset(sim_hooks, 0, sizeof(sim_hooks));
+    sim_oled.bytes_changed = 0;
+}
+
+static double average_ns(sim_hook_t hook) {
+    return sim_hooks[hook].calls ? (double)sim_hooks[hook].total_ns / sim_hooks[hook].calls : 0;
+}
+
+static void print_row(const char *name, uint32_t keys) {
+    printf("%-8s %10.0f %10llu %10.0f %10.0f %12.1f\n", name, average_ns(SIM_HOOK_OLED_TASK), (unsigned long long)sim_hooks[SIM_HOOK_OLED_TASK].max_ns, average_ns(SIM_HOOK_PROCESS_RECORD), average_ns(SIM_HOOK_HOUSEKEEPING), keys ? (double)sim_oled.bytes_changed / keys : 0);
+}
+
+typedef struct {
+    uint32_t bytes;
+    uint32_t messages;
+} link_t;
+
+static void print_link(const char *name, const link_t *before, uint32_t ms) {
+    printf("%-8s %10.1f %10.1f\n", name, (sim_split.bytes - before->bytes) * 1000.0 / ms, (sim_split.messages - before->messages) * 1000.0 / ms);
+}
+
+static uint32_t stat(uint8_t offset) {
+    uint8_t  data[RAW_EPSIZE] = {RAW_HID_STATUS_SYNC_STATS};
+    uint32_t value;
+
+    raw_hid_receive(data, sizeof(data));
+    memcpy(&value, sim_raw_hid_answer + offset, sizeof(value));
+    return value;
+}
+
+static void test_sync(void) {
+    link_t   before;
+    uint32_t start;
+
+    sim_split.loopback = true;
+    memset(sim_hooks, 0, sizeof(sim_hooks));
+    printf("%-8s %10s %10s\n", "sync", "bytes/s", "msgs/s");
+    before = (link_t){sim_split.bytes, sim_split.messages};
+    start  = timer_now_us() / 1000;
+    sim_type(text, 40, 80);
+    sim_type(text, 40, 80);
+    uint32_t ms = timer_now_us() / 1000 - start;
+    print_link("typing", &before, ms);
+    // A message on every housekeeping pass, what sending only changes saves.
+    uint32_t passes  = sim_hooks[SIM_HOOK_HOUSEKEEPING].calls;
+    uint32_t message = (sim_split.bytes - before.bytes) / (sim_split.messages - before.messages);
+    printf("%-8s %10.1f %10.1f\n", "full", (double)message * passes * 1000 / ms, 1000.0 * passes / ms);
+
+    // The figures status_sync.c reports over raw HID are the link's.
+    uint32_t bytes_rate = stat(1), messages_rate = stat(9);
+    CHECK(messages_rate && bytes_rate == messages_rate * message, "raw HID reports %u bytes/s for %u messages/s, the link takes %u bytes each", bytes_rate, messages_rate, message);
+
+    // WPM falls back to zero before the link is idle.
+    sim_run(10000);
+    before = (link_t){sim_split.bytes, sim_split.messages};
+    sim_run(10000);
+    print_link("idle", &before, 10000);
+    CHECK(sim_split.messages - before.messages <= 10000 / STATUS_SYNC_RESYNC + 1, "idle link carries only the resync, %u messages in 10 s", sim_split.messages - before.messages);
+
+    // Leader start and end change flags the mirror doesn't show. At most a
+    // resync falls into the sequence.
+    before = (link_t){sim_split.bytes, sim_split.messages};
+    CHECK(sim_tap_keycode(QK_LEAD, 0, 30, 50), "leader key on the base layer");
+    sim_run(LEADER_TIMEOUT + 100);
+    CHECK(!leader_sequence_active(), "leader sequence timed out");
+    CHECK(sim_split.messages - before.messages <= 1, "a leader sequence sent %u messages", sim_split.messages - before.messages);
+}
+
+// The logo's set pixels must survive the mirror; the mirror only writes where
+// the logo is blank.
+static void test_mirror(void) {
+    static uint8_t logo[OLED_MATRIX_SIZE];
+
+    oled_clear();
+    oled_write_rle_P(kyria_logo, sizeof(kyria_logo), 0);
+    memcpy(logo, sim_oled_buffer(), sizeof(logo));
+
+    sim_split.master = false;
+    suspend_wakeup_init();
+    sim_run(100);
+
+    const uint8_t *buffer  = sim_oled_buffer();
+    uint16_t       covered = 0;
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i++) {
+        covered += logo[i] && buffer[i] != logo[i];
+    }
+    CHECK(covered == 0, "%u logo bytes drawn over", covered);
+    CHECK(text_at(11, 0, "Default"), "layer mirrored next to the logo");
+    sim_split.master = true;
+}
+
+int main(void) {
+    sim_init();
+    sim_run(1000);
+
+    CHECK(text_at(0, 0, "Layer: Default"), "status drawn after boot");
+
+    printf("%-8s %10s %10s %10s %10s %12s\n", "phase", "oled ns", "oled max", "record ns", "house ns", "bytes/key");
+    reset_hooks();
+    sim_run(2000);
+    print_row("idle", 0);
+    CHECK(sim_oled.bytes_changed == 0, "an unchanged status leaves the buffer alone, %u bytes changed", sim_oled.bytes_changed);
+
+    reset_hooks();
+    sim_type(text, 40, 80);
+    sim_run(100);
+    print_row("typing", strlen(text));
+    // The WPM digits are the only field that changes while typing.
+    CHECK(sim_oled.bytes_changed <= strlen(text) * 3 * OLED_FONT_WIDTH, "%u bytes changed for %zu keys", sim_oled.bytes_changed, strlen(text));
+
+    keypos_t shift;
+    CHECK(sim_find_key(OSM(MOD_LSFT), 0, &shift), "shift on the base layer");
+    sim_tap(shift.row, shift.col, 30, 50);
+    CHECK(text_at(0, 1, "Oneshot: SHIFT"), "one-shot shift shown");
+    sim_type("a", 40, 80);
+    CHECK(!text_at(0, 1, "Oneshot: SHIFT"), "one-shot shift gone once used");
+
+    test_sync();
+    test_mirror();
+    return sim_exit_code();
+}
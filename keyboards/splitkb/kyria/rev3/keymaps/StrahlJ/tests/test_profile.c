@@ -0,0 +1,144 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// profile.c in the build with PROFILE_ENABLE, read over raw HID like
+// tools/profile_dump.py does: the hook slots must count what the harness
+// counts, the histogram buckets must split where profile.h says, and the
+// leader's P O must open the OLED page. Only built by `make test-profile`,
+// which `make test` runs after the plain build.
+
+#include "sim.h"
+#include "keymap_german.h"
+#include "raw_hid_commands.h"
+#include "profile.h"
+
+typedef struct {
+    uint32_t count;
+    uint32_t total_us;
+    uint16_t min_us;
+    uint16_t max_us;
+    uint16_t buckets[PROFILE_BUCKETS];
+} slot_t;
+
+static slot_t read_slot(uint8_t slot) {
+    uint8_t data[RAW_EPSIZE] = {RAW_HID_PROFILE_READ, slot};
+    slot_t  result;
+
+    raw_hid_receive(data, sizeof(data));
+    CHECK(sim_raw_hid_answer[2] == PROFILE_SLOT_COUNT, "answer for slot %u names %u slots", slot, sim_raw_hid_answer[2]);
+    memcpy(&result.count, sim_raw_hid_answer + 3, 4);
+    memcpy(&result.total_us, sim_raw_hid_answer + 7, 4);
+    memcpy(&result.min_us, sim_raw_hid_answer + 11, 2);
+    memcpy(&result.max_us, sim_raw_hid_answer + 13, 2);
+    memcpy(result.buckets, sim_raw_hid_answer + 15, sizeof(result.buckets));
+    return result;
+}
+
+static void request(uint8_t command) {
+    uint8_t data[RAW_EPSIZE] = {command};
+    raw_hid_receive(data, sizeof(data));
+}
+
+static void test_hooks(void) {
+    request(RAW_HID_PROFILE_RESET);
+    memset(sim_hooks, 0, sizeof(sim_hooks));
+
+    sim_type("hallo welt", 40, 80);
+    sim_run(1000);
+
+    slot_t record = read_slot(PROFILE_RECORD);
+    slot_t tail   = read_slot(PROFILE_QUANTUM_TAIL);
+    slot_t loop   = read_slot(PROFILE_LOOP);
+    printf("record %u, tail %u, loop %u\n", record.count, tail.count, loop.count);
+
+    CHECK(record.count == sim_hooks[SIM_HOOK_PROCESS_RECORD].calls, "%u records profiled, process_record_user() ran %u times", record.count, sim_hooks[SIM_HOOK_PROCESS_RECORD].calls);
+    CHECK(tail.count == sim_hooks[SIM_HOOK_POST_PROCESS_RECORD].calls, "%u tails profiled, post_process_record_user() ran %u times", tail.count, sim_hooks[SIM_HOOK_POST_PROCESS_RECORD].calls);
+    CHECK(loop.count + 1 == sim_hooks[SIM_HOOK_HOUSEKEEPING].calls, "%u loops profiled over %u housekeeping passes", loop.count, sim_hooks[SIM_HOOK_HOUSEKEEPING].calls);
+
+    uint8_t data[RAW_EPSIZE] = {RAW_HID_PROFILE_SCAN_RATE};
+    uint32_t scan_rate;
+    raw_hid_receive(data, sizeof(data));
+    memcpy(&scan_rate, sim_raw_hid_answer + 1, 4);
+    CHECK(scan_rate >= 900 && scan_rate <= 1100, "scan rate %u/s, the harness scans once per ms", scan_rate);
+
+    request(RAW_HID_PROFILE_RESET);
+    CHECK(read_slot(PROFILE_RECORD).count == 0, "reset clears the slots");
+}
+
+// A mod-tap held past the tapping term is settled as held when the term runs
+// out, a quick one as tapped on release.
+static void test_tap_hold(void) {
+    keypos_t key;
+    CHECK(sim_find_key(MT(MOD_LCTL, KC_ESC), 0, &key), "Ctrl/Esc on the base layer");
+
+    request(RAW_HID_PROFILE_RESET);
+    sim_press(key.row, key.col);
+    sim_run(60);
+    sim_release(key.row, key.col);
+    sim_run(500);
+    sim_press(key.row, key.col);
+    sim_run(400);
+    sim_release(key.row, key.col);
+    sim_run(500);
+
+    slot_t tap_hold = read_slot(PROFILE_TAP_HOLD);
+    printf("tap-hold %u, min %u ms, max %u ms\n", tap_hold.count, tap_hold.min_us, tap_hold.max_us);
+    CHECK(tap_hold.count == 2, "%u mod-tap presses settled", tap_hold.count);
+    CHECK(tap_hold.min_us >= 60 && tap_hold.min_us <= 62, "tap settled after %u ms, released at 60 ms", tap_hold.min_us);
+    CHECK(tap_hold.max_us >= 100 && tap_hold.max_us < 400, "hold settled after %u ms, within the tapping term of a 400 ms press", tap_hold.max_us);
+}
+
+static void test_buckets(void) {
+    static const struct {
+        uint32_t us;
+        uint8_t  bucket;
+    } durations[] = {
+        {0, 0}, {1, 0}, {2, 1}, {7, 1}, {8, 2}, {31, 2}, {32, 3}, {127, 3}, {128, 4}, {511, 4}, {512, 5}, {2047, 5}, {2048, 6}, {8191, 6}, {8192, 7}, {100000, 7},
+    };
+    uint16_t expected[PROFILE_BUCKETS] = {0};
+
+    request(RAW_HID_PROFILE_RESET);
+    for (uint8_t i = 0; i < ARRAY_SIZE(durations); i++) {
+        profile_add(PROFILE_LEADER, durations[i].us);
+        expected[durations[i].bucket]++;
+    }
+
+    slot_t slot = read_slot(PROFILE_LEADER);
+    CHECK(!memcmp(slot.buckets, expected, sizeof(expected)), "buckets %u %u %u %u %u %u %u %u", slot.buckets[0], slot.buckets[1], slot.buckets[2], slot.buckets[3], slot.buckets[4], slot.buckets[5], slot.buckets[6], slot.buckets[7]);
+    CHECK(slot.count == ARRAY_SIZE(durations) && slot.min_us == 0 && slot.max_us == UINT16_MAX, "count %u, min %u, max %u clamped", slot.count, slot.min_us, slot.max_us);
+
+    // An end without a begin, as when a handler swallows the key, adds nothing.
+    profile_end(PROFILE_LEADER);
+    CHECK(read_slot(PROFILE_LEADER).count == ARRAY_SIZE(durations), "a stray end is ignored");
+}
+
+static bool oled_line_is(uint8_t line, const char *text) {
+    for (uint8_t col = 0; text[col]; col++) {
+        if (sim_oled_char(col, line) != text[col]) return false;
+    }
+    return true;
+}
+
+static void test_oled_page(void) {
+    sim_tap_keycode(QK_LEAD, 0, 30, 50);
+    sim_type("po", 30, 50);
+    sim_run(LEADER_TIMEOUT + 600);
+    CHECK(oled_line_is(0, "Scan/s"), "leader P O opens the profile page");
+    CHECK(oled_line_is(1, "rec "), "the page lists process_record_user() first");
+
+    sim_tap_keycode(QK_LEAD, 0, 30, 50);
+    sim_type("po", 30, 50);
+    sim_run(LEADER_TIMEOUT + 100);
+    CHECK(!oled_line_is(0, "Scan/s"), "leader P O closes it again");
+}
+
+int main(void) {
+    sim_init();
+    sim_run(1000);
+
+    test_hooks();
+    test_tap_hold();
+    test_buckets();
+    test_oled_page();
+    return sim_exit_code();
+}
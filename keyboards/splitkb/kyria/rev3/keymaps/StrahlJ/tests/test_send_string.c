@@ -0,0 +1,114 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// send_string_fast() against QMK's send_string(): reports per string, the
+// host must read the same text, and no report may press a key together with
+// another key or a modifier change whose order matters. Keys and modifiers
+// the user holds must survive.
+
+#include "sim.h"
+#include "keymap_german.h"
+#include "send_string_fast.h"
+
+static const char *strings[] = {
+    "loadkeys de-latin1",
+    "Kaffee, Tee und Wasser.",
+    "Hallo Welt! 3 + 4 = 7? (ja)",
+    "a@b.de {x} [y] <z>",
+};
+
+typedef struct {
+    size_t   reports;
+    uint32_t ambiguous;
+    bool     same;
+} result_t;
+
+static result_t run(const char *string, bool fast) {
+    result_t result;
+
+    sim_reports_clear();
+    sim_host_clear();
+    if (fast) {
+        send_string_fast(string);
+    } else {
+        send_string(string);
+    }
+    sim_run(10);
+    result.reports   = sim_report_count(SIM_REPORT_KEYBOARD);
+    result.ambiguous = sim_host.ambiguous + sim_host.mods_with_keys;
+    result.same      = !strcmp(sim_host.text, string);
+    return result;
+}
+
+static void test_strings(void) {
+    printf("%-30s %10s %10s %10s\n", "string", "qmk", "fast", "fast/char");
+    for (uint8_t i = 0; i < ARRAY_SIZE(strings); i++) {
+        result_t qmk  = run(strings[i], false);
+        result_t fast = run(strings[i], true);
+        printf("%-30s %10zu %10zu %10.2f\n", strings[i], qmk.reports, fast.reports, (double)fast.reports / strlen(strings[i]));
+
+        CHECK(fast.same, "\"%s\" typed as \"%s\"", strings[i], sim_host.text);
+        CHECK(fast.ambiguous == 0, "\"%s\": %u reports whose order the host may not keep", strings[i], fast.ambiguous);
+        CHECK(fast.reports < qmk.reports, "\"%s\": %zu reports, send_string() takes %zu", strings[i], fast.reports, qmk.reports);
+    }
+}
+
+static bool last_report_has(uint8_t key) {
+    size_t              count;
+    const sim_report_t *reports = sim_reports(&count);
+    while (count--) {
+        if (reports[count].type != SIM_REPORT_KEYBOARD) continue;
+        for (uint8_t k = 0; k < KEYBOARD_REPORT_KEYS; k++) {
+            if (reports[count].keyboard.keys[k] == key) return true;
+        }
+        return false;
+    }
+    return false;
+}
+
+static void test_held_keys(void) {
+    keypos_t arrow, shift;
+
+    // A held arrow key on the navigation layer stays down throughout.
+    CHECK(sim_find_key(KC_LEFT, 1, &arrow) && sim_find_key(OSM(MOD_LSFT), 0, &shift), "Left on the nav layer, shift on the base layer");
+    layer_on(1);
+    sim_press(arrow.row, arrow.col);
+    sim_run(20);
+    sim_reports_clear();
+    send_string_fast("ab");
+    CHECK(last_report_has(KC_LEFT), "held Left still pressed after the string");
+    size_t              count;
+    const sim_report_t *reports = sim_reports(&count);
+    bool                kept    = true;
+    for (size_t i = 0; i < count; i++) {
+        bool has = false;
+        for (uint8_t k = 0; k < KEYBOARD_REPORT_KEYS; k++) {
+            has |= reports[i].keyboard.keys[k] == KC_LEFT;
+        }
+        kept &= has;
+    }
+    CHECK(kept, "Left in every report while the string is typed");
+    sim_release(arrow.row, arrow.col);
+    sim_run(20);
+    layer_off(1);
+
+    // A held shift doesn't change the string and is back afterwards.
+    sim_press(shift.row, shift.col);
+    sim_run(TAPPING_TERM + 50);
+    sim_host_clear();
+    send_string_fast("ab");
+    CHECK(!strcmp(sim_host.text, "ab"), "typed \"%s\" with shift held", sim_host.text);
+    CHECK(get_mods() == MOD_BIT(KC_LSFT), "shift held again, mods 0x%02X", get_mods());
+    sim_release(shift.row, shift.col);
+    sim_run(20);
+}
+
+int main(void) {
+    sim_init();
+    sim_run(1000);
+
+    send_string_fast_set_interval(0);
+    test_strings();
+    test_held_keys();
+    return sim_exit_code();
+}
@@ -0,0 +1,217 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// How CTL_ESC and ALT_ENT are settled: misfires and the time from press to
+// decision. The trace in traces/ is replayed first. It is synthetic, typed by
+// tests/record with fixed 40 ms holds, so it only shows that plain typing
+// replayed through the matrix settles its one Enter as a tap; it is no
+// evidence from real typing. Then scripted sequences with a known intent are
+// played at a slow and a fast typing pace: Enter and Escape inside a
+// streak, including rolls into the next key, Enter on its own held up to
+// 170 ms, and Ctrl and Alt shortcuts with keys from either hand pressed 30
+// to 180 ms after the modifier.
+
+#include <stdlib.h>
+#include "sim.h"
+#include "keymap_german.h"
+
+typedef struct {
+    uint32_t decisions;
+    uint32_t misfires;
+    uint32_t latency_sum;
+    uint32_t latency_max;
+} tally_t;
+
+static bool    want_tap;
+static tally_t tally;
+
+static void on_decision(const sim_tap_hold_t *decision) {
+    if (!IS_QK_MOD_TAP(decision->keycode)) return;
+    uint32_t latency = decision->settled - decision->pressed;
+    tally.decisions++;
+    tally.misfires += decision->tap != want_tap;
+    tally.latency_sum += latency;
+    tally.latency_max = MAX(tally.latency_max, latency);
+}
+
+// Key events at absolute times, played in order.
+typedef struct {
+    uint32_t time;
+    keypos_t key;
+    bool     pressed;
+} event_t;
+
+static event_t  events[128];
+static uint8_t  event_count;
+static uint32_t script_time;
+
+static void key(uint16_t keycode, uint32_t at, uint32_t hold) {
+    keypos_t position;
+    if (!sim_find_key(keycode, 0, &position)) {
+        CHECK(false, "keycode 0x%04X not on the base layer", keycode);
+        return;
+    }
+    if (event_count + 2u > ARRAY_SIZE(events)) return;
+    events[event_count++] = (event_t){script_time + at, position, true};
+    events[event_count++] = (event_t){script_time + at + hold, position, false};
+}
+
+static int by_time(const void *a, const void *b) {
+    const event_t *x = a, *y = b;
+    return x->time != y->time ? (x->time > y->time) - (x->time < y->time) : x->pressed - y->pressed;
+}
+
+static void play(void) {
+    qsort(events, event_count, sizeof(event_t), by_time);
+    uint32_t now = script_time;
+    for (uint8_t i = 0; i < event_count; i++) {
+        sim_run(events[i].time - now);
+        now = events[i].time;
+        if (events[i].pressed) {
+            sim_press(events[i].key.row, events[i].key.col);
+        } else {
+            sim_release(events[i].key.row, events[i].key.col);
+        }
+    }
+    sim_run(1);
+    event_count = 0;
+    script_time = 0;
+}
+
+// Types `word` from `at`, one key every `gap` ms held for `hold`, and returns
+// the time after its last press.
+static uint32_t word(const char *word, uint32_t at, uint32_t gap, uint32_t hold) {
+    for (; *word; word++, at += gap) {
+        key(*word == ' ' ? KC_SPC : *word == 'z' ? DE_Z : *word == 'y' ? DE_Y : KC_A + *word - 'a', at, hold);
+    }
+    return at;
+}
+
+typedef struct {
+    const char *name;
+    uint32_t    gap;  // between presses in a streak
+    uint32_t    hold; // how long a letter is held
+} pace_t;
+
+static const pace_t paces[] = {
+    {"40 wpm", 300, 110},
+    {"100 wpm", 120, 90},
+};
+
+// Typing a streak at `pace` long enough for the WPM counter to follow.
+static void warm_up(const pace_t *pace) {
+    word("das ist ein satz zum aufwaermen der zaehlt", 0, pace->gap, pace->hold);
+    play();
+}
+
+static void report(const char *name, const pace_t *pace) {
+    printf("%-28s %-8s %3u wpm %9u %9u %8.1f %8u\n", name, pace ? pace->name : "trace", get_current_wpm(), tally.decisions, tally.misfires, tally.decisions ? (double)tally.latency_sum / tally.decisions : 0, tally.latency_max);
+}
+
+static void begin(bool tap) {
+    want_tap = tap;
+    memset(&tally, 0, sizeof(tally));
+    sim_host_clear();
+}
+
+// Enter and Escape at the end of a word, `next` following at the streak's
+// pace. With `roll` the next key goes down 30 ms before the mod-tap
+// is up.
+static void streak_taps(const pace_t *pace, uint16_t keycode, const char *next, bool roll) {
+    begin(true);
+    for (uint8_t i = 0; i < 8; i++) {
+        warm_up(pace);
+        uint32_t at = word("wort", 0, pace->gap, pace->hold);
+        key(keycode, at, pace->hold);
+        word(next, at + (roll ? pace->hold - 30 : pace->gap), pace->gap, pace->hold);
+        play();
+        sim_run(1000);
+    }
+}
+
+// A mod-tap tapped on its own after a pause, held `hold` ms.
+static void lone_taps(const pace_t *pace, uint16_t keycode, uint32_t hold) {
+    begin(true);
+    for (uint8_t i = 0; i < 4; i++) {
+        warm_up(pace);
+        sim_run(400);
+        key(keycode, 0, hold);
+        play();
+        sim_run(1000);
+    }
+}
+
+// Modifier held, `other` tapped `delay` ms later, modifier released after it.
+static void shortcuts(const pace_t *pace, uint16_t modifier, uint16_t other) {
+    static const uint32_t delays[] = {30, 60, 90, 120, 180};
+
+    begin(false);
+    for (uint8_t i = 0; i < ARRAY_SIZE(delays); i++) {
+        warm_up(pace);
+        sim_run(400);
+        key(modifier, 0, delays[i] + 120);
+        key(other, delays[i], 70);
+        play();
+        sim_run(1000);
+    }
+}
+
+static void replay_traces(void) {
+    sim_trace_t trace;
+
+    begin(true);
+    if (!sim_trace_load("traces/typing.trace", &trace)) {
+        CHECK(false, "can't load traces/typing.trace");
+        return;
+    }
+    sim_replay(&trace, 1000);
+    sim_trace_free(&trace);
+    report("traces/typing.trace", NULL);
+    CHECK(tally.misfires == 0, "%u mod-taps in the trace were held", tally.misfires);
+}
+
+int main(void) {
+    sim_init();
+    sim_run(1000);
+    sim_tap_hold_callback = on_decision;
+
+    printf("%-28s %-8s %7s %9s %9s %8s %8s\n", "sequence", "pace", "wpm", "decisions", "misfires", "avg ms", "max ms");
+    replay_traces();
+    for (uint8_t p = 0; p < ARRAY_SIZE(paces); p++) {
+        const pace_t *pace = &paces[p];
+
+        streak_taps(pace, MT(MOD_LALT, KC_ENT), "neu", false);
+        report("Enter after a word", pace);
+        CHECK(tally.misfires == 0, "%s: Enter held", pace->name);
+        streak_taps(pace, MT(MOD_LALT, KC_ENT), "neu", true);
+        report("Enter rolled into a word", pace);
+        CHECK(tally.misfires == 0, "%s: rolled Enter held", pace->name);
+        streak_taps(pace, MT(MOD_LCTL, KC_ESC), "neu", false);
+        report("Escape after a word", pace);
+        CHECK(tally.misfires == 0, "%s: Escape held", pace->name);
+        streak_taps(pace, MT(MOD_LCTL, KC_ESC), "neu", true);
+        report("Escape rolled into a word", pace);
+        CHECK(tally.misfires == 0, "%s: rolled Escape held", pace->name);
+        streak_taps(pace, MT(MOD_LCTL, KC_ESC), "aus", true);
+        report("Escape rolled, same hand", pace);
+        CHECK(tally.misfires == 0, "%s: Escape rolled into its own hand held", pace->name);
+
+        lone_taps(pace, MT(MOD_LALT, KC_ENT), 140);
+        report("Enter alone, held 140 ms", pace);
+        CHECK(tally.misfires == 0, "%s: Enter held 140 ms", pace->name);
+        lone_taps(pace, MT(MOD_LALT, KC_ENT), 170);
+        report("Enter alone, held 170 ms", pace);
+        CHECK(tally.misfires == 0, "%s: Enter held 170 ms", pace->name);
+
+        shortcuts(pace, MT(MOD_LCTL, KC_ESC), DE_C);
+        report("Ctrl+C, same hand", pace);
+        CHECK(tally.misfires == 0, "%s: Ctrl+C tapped", pace->name);
+        shortcuts(pace, MT(MOD_LCTL, KC_ESC), DE_L);
+        report("Ctrl+L, other hand", pace);
+        CHECK(tally.misfires == 0, "%s: Ctrl+L tapped", pace->name);
+        shortcuts(pace, MT(MOD_LALT, KC_ENT), KC_TAB);
+        report("Alt+Tab, thumb", pace);
+        CHECK(tally.misfires == 0, "%s: Alt+Tab tapped", pace->name);
+    }
+    return sim_exit_code();
+}
@@ -0,0 +1,53 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// When typing_stats.c writes its counters: the first session after boot once
+// keys are idle, later ones at most every TYPING_STATS_SAVE_INTERVAL ms, and
+// whatever is left when the host suspends. Never while a key is processed.
+
+#include "sim.h"
+#include "typing_stats.h"
+#include "user_data.h"
+
+// Presses of `key` in the saved counters.
+static uint32_t saved_presses(keypos_t key) {
+    uint32_t count;
+    memcpy(&count, sim_datablock() + USER_DATA_STATS_OFFSET + (key.row * MATRIX_COLS + key.col) * sizeof(count), sizeof(count));
+    return count;
+}
+
+int main(void) {
+    keypos_t key;
+
+    sim_init();
+    sim_run(1000);
+    CHECK(sim_find_key(KC_E, 0, &key), "E on the base layer");
+
+    // First session: saved once idle, without waiting for the interval.
+    sim_type("eee", 40, 80);
+    sim_run(TYPING_STATS_SAVE_IDLE - 1000);
+    CHECK(saved_presses(key) == 0, "nothing saved while keys are recent");
+    sim_run(2000);
+    CHECK(saved_presses(key) == 3, "first session saved after %u ms idle, %u presses", TYPING_STATS_SAVE_IDLE, saved_presses(key));
+
+    // Second session: held back by the interval, saved on suspend.
+    sim_type("ee", 40, 80);
+    sim_run(TYPING_STATS_SAVE_IDLE + 1000);
+    CHECK(saved_presses(key) == 3, "second session waits for the interval");
+    suspend_power_down();
+    suspend_wakeup_init();
+    CHECK(saved_presses(key) == 5, "suspend saves the rest, %u presses", saved_presses(key));
+
+    // Third session: saved once the interval has passed.
+    uint32_t writes = sim_flash.writes;
+    suspend_power_down();
+    CHECK(sim_flash.writes == writes, "nothing new, nothing written");
+    suspend_wakeup_init();
+    sim_type("e", 40, 80);
+    sim_run(TYPING_STATS_SAVE_INTERVAL);
+    CHECK(saved_presses(key) == 6, "third session saved after the interval, %u presses", saved_presses(key));
+
+    CHECK(sim_flash.writes_in_keys == 0, "%u writes during key processing", sim_flash.writes_in_keys);
+    printf("%u writes, %u bytes\n", sim_flash.writes, sim_flash.bytes);
+    return sim_exit_code();
+}
@@ -0,0 +1,141 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// unicode_fast.c against QMK's register_unicode() and send_unicode_string()
+// in Linux input mode: reports per glyph, the host must read the same text
+// with and without Caps Lock, which must be back as it was, and no report may
+// press keys whose order matters. Then the leader's snake, the report
+// interval and setting it over raw HID.
+
+#include "sim.h"
+#include "raw_hid_commands.h"
+#include "unicode_fast.h"
+
+static const struct {
+    uint32_t    code_point;
+    const char *text;
+} glyphs[] = {
+    {0x00E9, "é"},
+    {0x2014, "—"},
+    {0x1F40D, "🐍"},
+    {0x1F600, "😀"},
+};
+
+static const char *strings[] = {
+    "Grüße 🐍",
+    "naïve café — 10 €",
+};
+
+typedef struct {
+    size_t   reports;
+    uint32_t ambiguous;
+    bool     same;
+} result_t;
+
+static result_t finish(const char *text, bool caps_lock) {
+    result_t result;
+
+    sim_run(10);
+    result.reports   = sim_report_count(SIM_REPORT_KEYBOARD);
+    result.ambiguous = sim_host.ambiguous + sim_host.mods_with_keys;
+    result.same      = !strcmp(sim_host.text, text) && sim_host.leds.caps_lock == caps_lock;
+    return result;
+}
+
+static void start(bool caps_lock) {
+    sim_reports_clear();
+    sim_host_clear();
+    sim_host.leds.caps_lock = caps_lock;
+}
+
+static result_t run_glyph(uint8_t i, bool fast, bool caps_lock) {
+    start(caps_lock);
+    if (fast) {
+        unicode_fast_send(glyphs[i].code_point);
+    } else {
+        register_unicode(glyphs[i].code_point);
+    }
+    return finish(glyphs[i].text, caps_lock);
+}
+
+static result_t run_string(const char *string, bool fast) {
+    start(false);
+    if (fast) {
+        unicode_fast_send_string(string);
+    } else {
+        send_unicode_string(string);
+    }
+    return finish(string, false);
+}
+
+static void test_glyphs(void) {
+    printf("%-8s %-6s %10s %10s\n", "glyph", "caps", "qmk", "fast");
+    for (uint8_t i = 0; i < ARRAY_SIZE(glyphs); i++) {
+        for (uint8_t caps_lock = 0; caps_lock < 2; caps_lock++) {
+            result_t qmk  = run_glyph(i, false, caps_lock);
+            result_t fast = run_glyph(i, true, caps_lock);
+            printf("U+%-6X %-6s %10zu %10zu\n", glyphs[i].code_point, caps_lock ? "on" : "off", qmk.reports, fast.reports);
+
+            CHECK(qmk.same, "U+%X: the stand-in register_unicode() typed \"%s\"", glyphs[i].code_point, sim_host.text);
+            CHECK(fast.same, "U+%X, caps lock %s: typed \"%s\", caps lock %s after", glyphs[i].code_point, caps_lock ? "on" : "off", sim_host.text, sim_host.leds.caps_lock ? "on" : "off");
+            CHECK(fast.ambiguous == 0, "U+%X: %u reports whose order the host may not keep", glyphs[i].code_point, fast.ambiguous);
+            CHECK(fast.reports < qmk.reports, "U+%X: %zu reports, register_unicode() takes %zu", glyphs[i].code_point, fast.reports, qmk.reports);
+        }
+    }
+}
+
+static void test_strings(void) {
+    printf("%-24s %10s %10s\n", "string", "qmk", "fast");
+    for (uint8_t i = 0; i < ARRAY_SIZE(strings); i++) {
+        result_t qmk  = run_string(strings[i], false);
+        result_t fast = run_string(strings[i], true);
+        printf("%-24s %10zu %10zu\n", strings[i], qmk.reports, fast.reports);
+
+        CHECK(fast.same, "\"%s\" typed as \"%s\"", strings[i], sim_host.text);
+        CHECK(fast.ambiguous == 0, "\"%s\": %u reports whose order the host may not keep", strings[i], fast.ambiguous);
+        CHECK(fast.reports < qmk.reports, "\"%s\": %zu reports, send_unicode_string() takes %zu", strings[i], fast.reports, qmk.reports);
+    }
+}
+
+// The leader sequence S S goes through unicode_fast_send_map().
+static void test_leader(void) {
+    sim_host_clear();
+    CHECK(sim_tap_keycode(QK_LEAD, 0, 40, 80), "leader key on the base layer");
+    sim_type("ss", 40, 80);
+    sim_run(LEADER_TIMEOUT + 100);
+    CHECK(!strcmp(sim_host.text, "🐍"), "leader S S typed \"%s\"", sim_host.text);
+}
+
+static void test_interval(void) {
+    uint8_t data[RAW_EPSIZE] = {RAW_HID_TYPING_INTERVAL};
+
+    raw_hid_receive(data, sizeof(data));
+    CHECK(sim_raw_hid_answer[0] == RAW_HID_TYPING_INTERVAL && sim_raw_hid_answer[1] == SEND_STRING_FAST_INTERVAL && sim_raw_hid_answer[2] == UNICODE_FAST_INTERVAL, "intervals read as %u and %u ms", sim_raw_hid_answer[1], sim_raw_hid_answer[2]);
+
+    memset(data, 0, sizeof(data));
+    data[0] = RAW_HID_TYPING_INTERVAL;
+    data[1] = 1;
+    data[2] = 2;
+    data[3] = 5;
+    raw_hid_receive(data, sizeof(data));
+    CHECK(sim_raw_hid_answer[1] == 2 && sim_raw_hid_answer[2] == 5, "intervals set to %u and %u ms", sim_raw_hid_answer[1], sim_raw_hid_answer[2]);
+    CHECK(send_string_fast_get_interval() == 2 && unicode_fast_get_interval() == 5, "set in the modules");
+
+    uint32_t begin   = timer_read32();
+    uint16_t reports = unicode_fast_send(0x1F40D);
+    uint32_t took    = timer_elapsed32(begin);
+    printf("interval 5 ms: %u reports in %u ms\n", reports, took);
+    CHECK(took == reports * 5u, "%u reports took %u ms at 5 ms each", reports, took);
+}
+
+int main(void) {
+    sim_init();
+    sim_run(1000);
+
+    sim_unicode_mode = UNICODE_MODE_LINUX;
+    test_glyphs();
+    test_strings();
+    test_leader();
+    test_interval();
+    return sim_exit_code();
+}
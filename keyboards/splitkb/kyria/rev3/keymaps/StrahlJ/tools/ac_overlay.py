@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Manage the autocorrect rules ac_overlay.c keeps on top of the flashed ones.
+
+Typos use the ac_dict.txt syntax: a-z and ', with a ':' at the start or end
+for a word boundary. Corrections may hold any UTF-8, umlauts are typed with
+their German layout keys. Rules added here survive a reboot without
+reflashing; move the ones worth keeping into ac_dict.txt eventually.
+
+Usage:
+    tools/ac_overlay.py list
+    tools/ac_overlay.py add TYPO CORRECTION
+    tools/ac_overlay.py delete TYPO
+    tools/ac_overlay.py clear
+    tools/ac_overlay.py import FILE
+"""
+
+import argparse
+import struct
+import sys
+
+from autocorrect_dawg import TYPO_CHARS
+from rawhid import RawHid, add_device_arguments
+
+AC_OVERLAY_ADD = 0xA0
+AC_OVERLAY_DELETE = 0xA1
+AC_OVERLAY_LIST = 0xA2
+AC_OVERLAY_CLEAR = 0xA3
+
+# Same as AC_OVERLAY_MAX_TYPO and AC_OVERLAY_MAX_CORRECTION in ac_overlay.h.
+MAX_TYPO = 12
+MAX_CORRECTION = 16
+
+# ac_overlay_result_t
+RESULTS = ['ok', 'invalid rule', 'overlay full', 'not found']
+FULL = 2
+
+
+def check_rule(typo, correction=None):
+    """Returns an error message, or None if the firmware will take the rule."""
+    if not typo or not all(c in TYPO_CHARS for c in typo):
+        return f'typo "{typo}" may only contain a-z, \' and :'
+    if ':' in typo.strip(':') or not typo.strip(':'):
+        return f'typo "{typo}" needs letters, ":" is only allowed at the start or end'
+    if len(typo) > MAX_TYPO:
+        return f'typo "{typo}" is longer than {MAX_TYPO} keys'
+    if correction is not None and not 0 < len(correction.encode('utf-8')) <= MAX_CORRECTION:
+        return f'correction "{correction}" must be 1 to {MAX_CORRECTION} bytes of UTF-8'
+    return None
+
+
+def send_rule(device, command, typo, correction=None):
+    payload = typo.encode('ascii') + b'\0'
+    if correction is not None:
+        payload += correction.encode('utf-8') + b'\0'
+    answer = device.request(command, payload)
+    rules, free = struct.unpack_from('<HH', answer, 2)
+    return answer[1], rules, free
+
+
+def list_rules(device):
+    index = 0
+    while True:
+        answer = device.request(AC_OVERLAY_LIST, struct.pack('<H', index))
+        if answer[1] != 0:
+            break
+        typo, correction = answer[2:].split(b'\0')[:2]
+        print(f'{typo.decode("ascii"):14} -> {correction.decode("utf-8", "replace")}')
+        index += 1
+    print(f'{index} rules')
+
+
+def read_rules(path):
+    rules = []
+    with open(path, encoding='utf-8') as f:
+        for line_number, line in enumerate(f, 1):
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            if '->' not in line:
+                sys.exit(f'{path}:{line_number}: expected "typo -> correction"')
+            typo, correction = (part.strip() for part in line.split('->', 1))
+            error = check_rule(typo.lower(), correction)
+            if error:
+                sys.exit(f'{path}:{line_number}: {error}')
+            rules.append((typo.lower(), correction))
+    return rules
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest='command', required=True)
+    commands.add_parser('list', help='print the stored rules')
+    add = commands.add_parser('add', help='add or replace a rule')
+    add.add_argument('typo')
+    add.add_argument('correction')
+    delete = commands.add_parser('delete', help='remove a rule')
+    delete.add_argument('typo')
+    commands.add_parser('clear', help='remove all rules')
+    load = commands.add_parser('import', help='add every rule of a file in ac_dict.txt syntax')
+    load.add_argument('file')
+    add_device_arguments(parser)
+    args = parser.parse_args()
+
+    rules = []
+    if args.command == 'import':
+        rules = read_rules(args.file)
+    elif args.command in ('add', 'delete'):
+        args.typo = args.typo.lower()
+        error = check_rule(args.typo, args.correction if args.command == 'add' else None)
+        if error:
+            sys.exit(error)
+
+    with RawHid(args.vid, args.pid) as device:
+        if args.command == 'list':
+            list_rules(device)
+            return
+        if args.command == 'clear':
+            device.request(AC_OVERLAY_CLEAR)
+            return
+        if args.command == 'add':
+            rules = [(args.typo, args.correction)]
+
+        result, count, free = 0, 0, 0
+        if args.command == 'delete':
+            result, count, free = send_rule(device, AC_OVERLAY_DELETE, args.typo)
+        for typo, correction in rules:
+            result, count, free = send_rule(device, AC_OVERLAY_ADD, typo, correction)
+            if result != 0:
+                print(f'{typo} -> {correction}: {RESULTS[result]}', file=sys.stderr)
+                if result == FULL:
+                    break
+        print(f'{RESULTS[result]}, {count} rules, {free} bytes free')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Compile an autocorrect dictionary into autocorrect_data.h.
+
+The output uses the same trie format as `qmk generate-autocorrect-data`, so
+QMK's autocorrect lookup reads it unchanged. The difference is that identical
+subtrees are stored only once and shared through the branch links, turning the
+trie into a DAWG. Large dictionaries have many rules ending in the same
+correction tail (e.g. "ie" -> "ei" swaps), and those collapse into one copy.
+
+The lookup cost per keystroke does not grow with the number of rules: QMK walks
+at most AUTOCORRECT_MAX_LENGTH nodes and scans at most 28 entries per branch.
+`--stats` prints the measured worst case for the generated table.
+
+Dictionary format, one rule per line, '#' starts a comment:
+    typo -> correction
+A ':' at the start or end of a typo marks a word boundary.
+
+Usage:
+    tools/autocorrect_dawg.py ac_dict.txt -o autocorrect_data.h [--stats]
+"""
+
+import argparse
+import os
+import sys
+
+KC_A = 0x04
+KC_SPC = 0x2C
+KC_QUOT = 0x34
+
+TYPO_CHARS = dict([("'", KC_QUOT), (':', KC_SPC)] + [(chr(c), c + KC_A - ord('a')) for c in range(ord('a'), ord('z') + 1)])
+
+
+def parse_file(path):
+    rules = []
+    with open(path, encoding='utf-8') as f:
+        for line_number, line in enumerate(f, 1):
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            if '->' not in line:
+                sys.exit(f'{path}:{line_number}: expected "typo -> correction"')
+            typo, correction = (part.strip() for part in line.split('->', 1))
+            typo = typo.lower()
+            if not typo or not all(c in TYPO_CHARS for c in typo):
+                sys.exit(f'{path}:{line_number}: typo "{typo}" may only contain a-z, \' and :')
+            if ':' in typo.strip(':'):
+                sys.exit(f'{path}:{line_number}: ":" is only allowed at the start or end of a typo')
+            if not correction or not correction.isascii():
+                sys.exit(f'{path}:{line_number}: correction must be non-empty ASCII')
+            rules.append((typo, correction, line_number))
+
+    # A typo that contains another typo could never trigger, the shorter one fires first.
+    typos = {}
+    for typo, _, line_number in rules:
+        if typo in typos:
+            sys.exit(f'{path}:{line_number}: duplicate typo "{typo}" (first on line {typos[typo]})')
+        typos[typo] = line_number
+    for typo, _, line_number in rules:
+        for other, other_line in typos.items():
+            if other != typo and other in typo:
+                sys.exit(f'{path}:{line_number}: typo "{typo}" contains typo "{other}" from line {other_line}')
+    return [(typo, correction) for typo, correction, _ in rules]
+
+
+def make_trie(rules):
+    trie = {}
+    for typo, correction in rules:
+        node = trie
+        for letter in reversed(typo):
+            node = node.setdefault(letter, {})
+        node['LEAF'] = (typo, correction)
+    return trie
+
+
+def leaf_data(typo, correction):
+    boundary_end = typo.endswith(':')
+    typo = typo.strip(':')
+    i = 0
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + boundary_end
+    if not 0 <= backspaces <= 63:
+        sys.exit(f'typo "{typo}" needs {backspaces} backspaces, at most 63 are supported')
+    return [backspaces | 0x80] + list(correction[i:].encode('ascii')) + [0]
+
+
+class Entry:
+    def __init__(self, kind, chars='', data=None, links=None):
+        self.kind = kind
+        self.chars = chars
+        self.data = data or []
+        self.links = links or []
+        self.offset = 0
+
+    def serialize(self):
+        if self.kind == 'leaf':
+            return self.data
+        if self.kind == 'chain':
+            return [TYPO_CHARS[c] for c in self.chars] + [0]
+        out = []
+        for c, link in zip(self.chars, self.links):
+            out += [TYPO_CHARS[c] | (0 if out else 0x40), link.offset & 0xFF, link.offset >> 8]
+        return out + [0]
+
+
+def build_table(trie, share):
+    """Flattens the trie into table entries in QMK order.
+
+    A chain entry is always directly followed by its child, which the lookup
+    reaches without a link. Branch children are reached through 16-bit links,
+    so with `share` an identical subtree seen before is linked to instead of
+    being emitted again.
+    """
+    table = []
+    shared = {}
+
+    def key(node):
+        if 'LEAF' in node:
+            return ('leaf', tuple(leaf_data(*node['LEAF'])))
+        return tuple(sorted((c, key(child)) for c, child in node.items()))
+
+    def traverse(node, linked):
+        node_key = key(node) if share else None
+        if linked and share and node_key in shared:
+            return shared[node_key]
+
+        if 'LEAF' in node:
+            entry = Entry('leaf', data=leaf_data(*node['LEAF']))
+            table.append(entry)
+        elif len(node) == 1:
+            c, child = next(iter(node.items()))
+            chars = c
+            while len(child) == 1 and 'LEAF' not in child:
+                c, child = next(iter(child.items()))
+                chars += c
+            target = shared.get(key(child)) if share else None
+            if target is not None and len(target.serialize()) > 3:
+                # The tail already exists elsewhere: end the chain with a
+                # one-entry branch whose link points at the existing copy.
+                branch = Entry('branch', chars=chars[-1], links=[target])
+                if len(chars) > 1:
+                    entry = Entry('chain', chars=chars[:-1], links=[branch])
+                    table.append(entry)
+                else:
+                    entry = branch
+                table.append(branch)
+            else:
+                entry = Entry('chain', chars=chars)
+                table.append(entry)
+                entry.links = [traverse(child, False)]
+        else:
+            entry = Entry('branch', chars=''.join(sorted(node)))
+            table.append(entry)
+            entry.links = [traverse(node[c], True) for c in entry.chars]
+
+        if share:
+            shared.setdefault(node_key, entry)
+        return entry
+
+    traverse(trie, False)
+
+    offset = 0
+    for entry in table:
+        entry.offset = offset
+        offset += len(entry.serialize())
+    if offset > 0xFFFF:
+        sys.exit(f'dictionary needs {offset} bytes, links can only address 65535')
+    return [b for entry in table for b in entry.serialize()]
+
+
+def lookup(data, keys):
+    """Port of the trie walk in QMK's process_autocorrect.c.
+
+    Returns (backspaces, text, bytes_read) for a match, or (None, None, bytes_read).
+    """
+    reads = 1
+    state = 0
+    code = data[0]
+    for key in reversed(keys):
+        if code & 0x40:
+            code &= 0x3F
+            while code != key:
+                if not code:
+                    return None, None, reads
+                state += 3
+                code = data[state]
+                reads += 1
+            state = data[state + 1] | data[state + 2] << 8
+            reads += 2
+        elif code != key:
+            return None, None, reads
+        else:
+            state += 1
+            code = data[state]
+            reads += 1
+            if not code:
+                state += 1
+        if state >= len(data):
+            return None, None, reads
+        code = data[state]
+        reads += 1
+        if code & 0x80:
+            end = data.index(0, state + 1)
+            return code & 0x3F, bytes(data[state + 1:end]).decode('ascii'), reads
+    return None, None, reads
+
+
+def verify(data, rules):
+    """Checks that every rule resolves to its correction through the QMK walk."""
+    for typo, correction in rules:
+        keys = [KC_SPC] + [TYPO_CHARS[c] for c in typo.lstrip(':')] if typo.startswith(':') else [TYPO_CHARS['x']] + [TYPO_CHARS[c] for c in typo]
+        expected = leaf_data(typo, correction)
+        backspaces, text, _ = lookup(data, keys)
+        if backspaces != expected[0] & 0x3F or text != bytes(expected[1:-1]).decode('ascii'):
+            sys.exit(f'internal error: "{typo}" does not resolve to "{correction}"')
+
+
+def worst_case_reads(trie, data):
+    """Most table bytes a single keystroke can read, over every path in the trie."""
+    worst = 0
+    stack = [('', trie)]
+    while stack:
+        suffix, node = stack.pop()
+        for c, child in node.items():
+            if c == 'LEAF':
+                continue
+            # Try every letter after the known suffix, hits and misses alike.
+            path = c + suffix
+            stack.append((path, child))
+            for probe in TYPO_CHARS.values():
+                keys = [probe] + [TYPO_CHARS[ch] for ch in path]
+                worst = max(worst, lookup(data, keys)[2])
+    return worst
+
+
+def write_header(path, rules, data):
+    min_typo = min((typo for typo, _ in rules), key=len)
+    max_typo = max((typo for typo, _ in rules), key=len)
+    width = max(len(typo) for typo, _ in rules)
+
+    lines = [
+        '// Generated by tools/autocorrect_dawg.py from ac_dict.txt, do not edit.',
+        '// SPDX-License-Identifier: GPL-2.0-or-later',
+        '',
+        '#pragma once',
+        '',
+        f'// Autocorrection dictionary ({len(rules)} entries):',
+    ]
+    lines += [f'//   {typo:<{width}} -> {correction}' for typo, correction in rules]
+    lines += [
+        '',
+        f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"',
+        f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"',
+        f'#define DICTIONARY_SIZE {len(data)}',
+        '',
+        'static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {',
+    ]
+    lines += ['    ' + ', '.join(f'0x{b:02X}' for b in data[i:i + 16]) + (',' if i + 16 < len(data) else '') for i in range(0, len(data), 16)]
+    lines += ['};', '']
+
+    tmp = path + '.tmp'
+    with open(tmp, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(lines))
+    os.replace(tmp, path)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('dictionary', help='dictionary file, e.g. ac_dict.txt')
+    parser.add_argument('-o', '--output', required=True, help='header to write, e.g. autocorrect_data.h')
+    parser.add_argument('--no-share', action='store_true', help='emit a plain trie like qmk generate-autocorrect-data')
+    parser.add_argument('--stats', action='store_true', help='print size and lookup cost, compared with a plain trie')
+    args = parser.parse_args()
+
+    rules = parse_file(args.dictionary)
+    if not rules:
+        sys.exit(f'{args.dictionary}: no rules')
+    trie = make_trie(rules)
+    data = build_table(trie, not args.no_share)
+    verify(data, rules)
+    write_header(args.output, rules, data)
+
+    if args.stats:
+        plain = build_table(trie, False)
+        for name, table in (('plain trie', plain), ('generated', data)):
+            print(f'{name:>10}: {len(table):6} bytes, {len(table) / len(rules):5.2f} bytes/rule, '
+                  f'at most {worst_case_reads(trie, table)} table reads per keystroke', file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Convert a bitmap into an RLE compressed OLED header.
+
+The input is either a PNG (needs Pillow) or a raw file that is already in the
+OLED page layout used by oled_write_raw(): one byte per column, eight rows per
+page, pages top to bottom.
+
+Stream format, decoded by bitmap_rle.c:
+    0x00-0x7F  n   literal: the next n + 1 bytes are copied as they are
+    0x80-0xFF  n   repeat:  the next byte is written (n & 0x7F) + 1 times
+
+Usage:
+    tools/bitmap_rle.py logo.png --name kyria_logo > kyria_logo.h
+    tools/bitmap_rle.py logo.bin --raw --name kyria_logo > kyria_logo.h
+"""
+
+import argparse
+import sys
+
+MAX_RUN = 128
+
+
+def png_to_pages(path, threshold):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit('Pillow is required to read PNG files: pip install pillow')
+
+    image = Image.open(path).convert('L')
+    width, height = image.size
+    if height % 8:
+        sys.exit(f'{path}: height {height} is not a multiple of 8')
+
+    pixels = image.load()
+    pages = bytearray()
+    for page in range(height // 8):
+        for x in range(width):
+            byte = 0
+            for bit in range(8):
+                if pixels[x, page * 8 + bit] >= threshold:
+                    byte |= 1 << bit
+            pages.append(byte)
+    return bytes(pages), width, height
+
+
+def encode(data):
+    out = bytearray()
+    literal = bytearray()
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < MAX_RUN and data[i + run] == data[i]:
+            run += 1
+        # A run of two only pays off when it does not split a literal.
+        if run >= 3 or (run == 2 and not literal):
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.append(data[i])
+            i += run
+        else:
+            literal.append(data[i])
+            i += 1
+    flush_literal()
+    return bytes(out)
+
+
+def decode(stream):
+    out = bytearray()
+    i = 0
+    while i < len(stream):
+        control = stream[i]
+        if control & 0x80:
+            out.extend(stream[i + 1:i + 2] * ((control & 0x7F) + 1))
+            i += 2
+        else:
+            out.extend(stream[i + 1:i + 2 + control])
+            i += control + 2
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', help='PNG file, or raw OLED page data with --raw')
+    parser.add_argument('--raw', action='store_true', help='input is raw OLED page data')
+    parser.add_argument('--width', type=int, default=128, help='width of raw input in pixels (default: 128)')
+    parser.add_argument('--name', required=True, help='name of the generated array')
+    parser.add_argument('--threshold', type=int, default=128, help='grey level at which a PNG pixel is lit (default: 128)')
+    args = parser.parse_args()
+
+    if args.raw:
+        with open(args.input, 'rb') as f:
+            data = f.read()
+        width = args.width
+        height = len(data) // width * 8
+    else:
+        data, width, height = png_to_pages(args.input, args.threshold)
+
+    stream = encode(data)
+    if decode(stream) != data:
+        sys.exit('internal error: encoded stream does not decode to the input')
+
+    print('// Generated by tools/bitmap_rle.py, do not edit.')
+    print(f'// {width}x{height} pixels, {len(data)} bytes raw, {len(stream)} bytes compressed.')
+    print()
+    print('#pragma once')
+    print()
+    print('// clang-format off')
+    print(f'static const uint8_t PROGMEM {args.name}[] = {{')
+    for i in range(0, len(stream), 16):
+        print('    ' + ', '.join(f'0x{b:02X}' for b in stream[i:i + 16]) + ',')
+    print('};')
+    print('// clang-format on')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Control the key event recorder in keylog.c and save its buffer as a trace.
+
+Build with KEYLOG_ENABLE = yes in rules.mk. Recording is started and stopped
+with --start/--stop or the leader sequence K R. Saving stops recording first,
+so the buffer does not move while it is read.
+
+The trace is plain text, one matrix event per line, with the time in
+microseconds since the first event and the state before the event:
+    <time_us> <row> <col> down|up layer=0x0003 mods=0x00 osm=0x02 osm_locked=0x00 [caps_word] [leader]
+Lines starting with '#' are comments. It is meant as input for replaying a
+session against the keymap; the '# matrix <rows>x<cols>' line lets the replay
+refuse a trace whose positions were recorded on a different matrix.
+
+Usage:
+    tools/keylog_dump.py --start
+    tools/keylog_dump.py -o session.trace [--clear]
+"""
+
+import argparse
+import struct
+import sys
+
+from rawhid import RawHid, add_device_arguments
+
+KEYLOG_START = 0x60
+KEYLOG_STOP = 0x61
+KEYLOG_CLEAR = 0x62
+KEYLOG_STATUS = 0x63
+KEYLOG_READ = 0x64
+
+# Same layout as keylog_entry_t in keylog.h.
+ENTRY = struct.Struct('<IBBHBBBB')
+PRESSED = 0x80
+FLAGS = [(0x01, 'caps_word'), (0x02, 'leader')]
+
+
+def status(device):
+    answer = device.request(KEYLOG_STATUS)
+    count, size, overwritten = struct.unpack_from('<HHI', answer, 2)
+    return bool(answer[1]), count, size, overwritten, (answer[10], answer[11])
+
+
+def read_entries(device):
+    entries = []
+    count = 1
+    while len(entries) < count:
+        answer = device.request(KEYLOG_READ, struct.pack('<H', len(entries)))
+        count, index = struct.unpack_from('<HH', answer, 1)
+        if index != len(entries):
+            sys.exit(f'asked for entry {len(entries)}, got {index}')
+        for offset in range(5, 5 + 2 * ENTRY.size, ENTRY.size):
+            if len(entries) < count:
+                entries.append(ENTRY.unpack_from(answer, offset))
+    return entries
+
+
+def write_trace(f, entries, overwritten, matrix):
+    f.write('# keylog trace v1: time_us row col down|up, then the state before the event\n')
+    f.write(f'# matrix {matrix[0]}x{matrix[1]}\n')
+    if overwritten:
+        f.write(f'# {overwritten} older events were overwritten\n')
+    start = entries[0][0] if entries else 0
+    elapsed = 0
+    previous = start
+    for time_us, row, col_pressed, layer, mods, oneshot, oneshot_locked, flags in entries:
+        # The keyboard's microsecond timer wraps after about 71 minutes.
+        elapsed += (time_us - previous) & 0xFFFFFFFF
+        previous = time_us
+        action = 'down' if col_pressed & PRESSED else 'up'
+        names = ''.join(f' {name}' for bit, name in FLAGS if flags & bit)
+        f.write(f'{elapsed} {row} {col_pressed & ~PRESSED} {action} layer=0x{layer:04X} mods=0x{mods:02X} '
+                f'osm=0x{oneshot:02X} osm_locked=0x{oneshot_locked:02X}{names}\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-o', '--output', help='write the recorded events to this trace file, - for stdout')
+    parser.add_argument('--start', action='store_true', help='start recording')
+    parser.add_argument('--stop', action='store_true', help='stop recording')
+    parser.add_argument('--clear', action='store_true', help='empty the buffer, after saving it if -o is given')
+    add_device_arguments(parser)
+    args = parser.parse_args()
+
+    with RawHid(args.vid, args.pid) as device:
+        if args.stop or args.output:
+            device.request(KEYLOG_STOP)
+        if args.output:
+            _, count, size, overwritten, matrix = status(device)
+            entries = read_entries(device) if count else []
+            if args.output == '-':
+                write_trace(sys.stdout, entries, overwritten, matrix)
+            else:
+                with open(args.output, 'w', encoding='utf-8') as f:
+                    write_trace(f, entries, overwritten, matrix)
+            print(f'saved {len(entries)} of {size} events', file=sys.stderr)
+        if args.clear:
+            device.request(KEYLOG_CLEAR)
+        if args.start:
+            device.request(KEYLOG_START)
+
+        recording, count, size, overwritten, _ = status(device)
+        print(f'{"recording" if recording else "stopped"}, {count}/{size} events, {overwritten} overwritten', file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
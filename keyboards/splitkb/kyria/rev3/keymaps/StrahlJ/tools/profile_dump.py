@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Print the hook latency statistics collected by profile.c.
+
+Build with PROFILE_ENABLE = yes in rules.mk. The same numbers are printed to
+the console by the leader sequence P D and shown on the OLED by P O. The
+split status sync rates and the idle governor's time in each stage and key
+latencies follow when the firmware answers those commands.
+
+Usage:
+    tools/profile_dump.py [--reset] [--watch SECONDS]
+"""
+
+import argparse
+import struct
+import time
+
+from rawhid import RawHid, add_device_arguments
+
+PROFILE_READ = 0x50
+PROFILE_SCAN_RATE = 0x51
+PROFILE_RESET = 0x52
+STATUS_SYNC_STATS = 0x70
+IDLE_STATS = 0x80
+IDLE_RESET = 0x81
+
+# Same order as profile_slot_t in profile.h.
+SLOT_NAMES = ['loop', 'record', 'key override', 'caps word', 'quantum tail', 'leader', 'oled', 'tap-hold', 'ac lookup']
+# Slots counted in ms instead of us.
+MS_SLOTS = {'tap-hold'}
+IDLE_STATES = ['active', 'dimmed', 'off']
+BUCKET_LIMITS = ['<2', '<8', '<32', '<128', '<512', '<2k', '<8k', '>=8k']
+
+
+def read_slot(device, slot):
+    answer = device.request(PROFILE_READ, [slot])
+    slot_count = answer[2]
+    count, total, low, high = struct.unpack_from('<IIHH', answer, 3)
+    buckets = struct.unpack_from('<8H', answer, 15)
+    return slot_count, count, total, low, high, buckets
+
+
+def dump(device):
+    scan_rate, = struct.unpack_from('<I', device.request(PROFILE_SCAN_RATE), 1)
+    print(f'scan rate: {scan_rate}/s')
+    print(f'{"slot":>12} {"count":>8} {"avg us":>8} {"min us":>7} {"max us":>7}  ' + ' '.join(f'{b:>6}' for b in BUCKET_LIMITS))
+
+    slot, slot_count = 0, 1
+    while slot < slot_count:
+        slot_count, count, total, low, high, buckets = read_slot(device, slot)
+        name = SLOT_NAMES[slot] if slot < len(SLOT_NAMES) else f'slot {slot}'
+        average = total / count if count else 0
+        unit = ' ms' if name in MS_SLOTS else ''
+        print(f'{name:>12} {count:8} {average:8.1f} {low:7} {high:7}  ' + ' '.join(f'{b:6}' for b in buckets) + unit)
+        slot += 1
+
+    answer = device.request(STATUS_SYNC_STATS, optional=True)
+    if answer:
+        sync_bytes, full_bytes, messages = struct.unpack_from('<III', answer, 1)
+        print(f'split status sync: {sync_bytes} bytes/s in {messages} messages, '
+              f'{full_bytes} bytes/s if the full state was sent every loop')
+
+    answer = device.request(IDLE_STATS, optional=True)
+    if answer:
+        times = struct.unpack_from('<3I', answer, 2)
+        wakes, active_avg, active_max, wake_avg, wake_max = struct.unpack_from('<I4H', answer, 14)
+        print(f'idle: now {IDLE_STATES[answer[1]]}, ' + ', '.join(f'{name} {ms / 1000:.0f} s' for name, ms in zip(IDLE_STATES, times)))
+        print(f'key seen after: {active_avg} us avg, {active_max} us max while active, '
+              f'{wake_avg} us avg, {wake_max} us max for the first key of {wakes} wakes')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--reset', action='store_true', help='clear the statistics after reading them')
+    parser.add_argument('--watch', type=float, metavar='SECONDS', help='keep printing at this interval')
+    add_device_arguments(parser)
+    args = parser.parse_args()
+
+    with RawHid(args.vid, args.pid) as device:
+        while True:
+            dump(device)
+            if args.reset:
+                device.request(PROFILE_RESET)
+                device.request(IDLE_RESET, optional=True)
+            if not args.watch:
+                break
+            time.sleep(args.watch)
+            print()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,64 @@
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Raw HID transport shared by the host tools.
+
+Talks to the keymap's raw_hid_receive() through the QMK raw HID interface
+(usage page 0xFF60, usage 0x61) with 32-byte reports. Needs the `hidapi`
+package (pip install hidapi). Command bytes are listed in raw_hid_commands.h.
+"""
+
+import sys
+
+REPORT_SIZE = 32
+USAGE_PAGE = 0xFF60
+USAGE = 0x61
+UNHANDLED = 0xFF
+
+# Kyria rev3, see the keyboard's info.json.
+VENDOR_ID = 0x8D1D
+PRODUCT_ID = 0x9D9D
+
+
+class RawHid:
+    def __init__(self, vendor_id=VENDOR_ID, product_id=PRODUCT_ID):
+        try:
+            import hid
+        except ImportError:
+            sys.exit('the hidapi package is required: pip install hidapi')
+        paths = [d['path'] for d in hid.enumerate(vendor_id, product_id) if d['usage_page'] == USAGE_PAGE and d['usage'] == USAGE]
+        if not paths:
+            sys.exit(f'no raw HID interface found for {vendor_id:04X}:{product_id:04X}')
+        self.device = hid.device()
+        self.device.open_path(paths[0])
+
+    def close(self):
+        self.device.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *_):
+        self.close()
+
+    def request(self, command, payload=b'', timeout_ms=1000, optional=False):
+        """Sends one report and returns the keyboard's answer as bytes.
+
+        With `optional`, a command the firmware does not handle returns None.
+        """
+        report = bytes([command]) + bytes(payload)
+        if len(report) > REPORT_SIZE:
+            raise ValueError(f'payload too long for a {REPORT_SIZE} byte report')
+        # The leading 0 is the report ID hidapi expects.
+        self.device.write(b'\0' + report.ljust(REPORT_SIZE, b'\0'))
+        answer = bytes(self.device.read(REPORT_SIZE, timeout_ms))
+        if not answer:
+            sys.exit(f'no answer to command 0x{command:02X}')
+        if answer[0] == UNHANDLED:
+            if optional:
+                return None
+            sys.exit(f'command 0x{command:02X} is not handled, is the feature enabled in rules.mk?')
+        return answer
+
+
+def add_device_arguments(parser):
+    parser.add_argument('--vid', type=lambda v: int(v, 16), default=VENDOR_ID, help='USB vendor ID in hex')
+    parser.add_argument('--pid', type=lambda v: int(v, 16), default=PRODUCT_ID, help='USB product ID in hex')
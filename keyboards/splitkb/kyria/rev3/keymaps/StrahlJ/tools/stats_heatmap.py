@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Draw the key press counters collected by typing_stats.c as a heatmap.
+
+Keys are placed by matrix position, the left half on the left. With --info
+pointing at the keyboard's keyboard.json or info.json from qmk_firmware, they
+are placed like on the physical board instead. The presses per layer and the
+autocorrect count follow below the map.
+
+Usage:
+    tools/stats_heatmap.py [--info keyboard.json] [--no-color] [--reset]
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+from rawhid import RawHid, add_device_arguments
+
+TYPING_STATS_READ = 0x90
+TYPING_STATS_RESET = 0x91
+
+SECTION_KEYS = 0
+SECTION_LAYERS = 1
+SECTION_AUTOCORRECT = 2
+ENTRIES_PER_REPORT = 6
+
+# Same order as enum layers in keymap.c.
+LAYER_NAMES = ['QWERTZ', 'NAV', 'SYM', 'BRACS', 'FUNCTION', 'GAMING', 'MOUSE']
+
+# xterm-256 colors from cold to hot.
+HEAT = [17, 18, 19, 20, 21, 27, 33, 39, 45, 51, 50, 49, 48, 47, 46, 82, 118, 154, 190, 226, 220, 214, 208, 202, 196]
+CELL = 7
+
+
+def read_section(device, section):
+    """Returns the section's counters and the matrix column count."""
+    counters, size, cols = [], 1, 0
+    while len(counters) < size:
+        answer = device.request(TYPING_STATS_READ, [section, len(counters)])
+        size, cols = answer[3], answer[4]
+        count = min(ENTRIES_PER_REPORT, size - len(counters))
+        counters += struct.unpack_from(f'<{count}I', answer, 5)
+    return counters, cols
+
+
+def matrix_positions(rows, cols):
+    """(row, col) -> (line, column) with the two halves side by side."""
+    half = rows // 2
+    positions = {}
+    for row in range(rows):
+        for col in range(cols):
+            right = row >= half
+            x = col + (cols + 1 if right else 0)
+            positions[(row, col)] = (row - half if right else row, x * CELL)
+    return positions
+
+
+def info_positions(path):
+    with open(path, encoding='utf-8') as f:
+        info = json.load(f)
+    layouts = info.get('layouts')
+    if not layouts:
+        sys.exit(f'{path}: no layouts')
+    layout = layouts.get('LAYOUT') or next(iter(layouts.values()))
+    return {tuple(key['matrix']): (round(key['y']), round(key['x'] * CELL)) for key in layout['layout']}
+
+
+def cell(count, peak, color):
+    text = f'{count:^{CELL - 1}}'[:CELL - 1]
+    if not color:
+        return text + ' '
+    heat = HEAT[min(len(HEAT) - 1, count * len(HEAT) // (peak + 1))] if count else 236
+    foreground = 16 if heat in HEAT[9:] else 231
+    return f'\033[48;5;{heat}m\033[38;5;{foreground}m{text}\033[0m '
+
+
+def draw(keys, cols, positions, color):
+    rows = len(keys) // cols
+    peak = max(keys) or 1
+    lines = {}
+    for (row, col), (line, x) in positions.items():
+        if row >= rows or col >= cols:
+            continue
+        lines.setdefault(line, []).append((x, keys[row * cols + col]))
+
+    for line in sorted(lines):
+        out, column = '', 0
+        for x, count in sorted(lines[line]):
+            out += ' ' * max(0, x - column) + cell(count, peak, color)
+            column = max(column, x) + CELL
+        print(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--info', metavar='JSON', help="keyboard.json or info.json with the keyboard's LAYOUT")
+    parser.add_argument('--no-color', action='store_true', help='plain counts without ANSI colors')
+    parser.add_argument('--reset', action='store_true', help='clear the counters after reading them')
+    add_device_arguments(parser)
+    args = parser.parse_args()
+
+    with RawHid(args.vid, args.pid) as device:
+        keys, cols = read_section(device, SECTION_KEYS)
+        layers, _ = read_section(device, SECTION_LAYERS)
+        autocorrect, _ = read_section(device, SECTION_AUTOCORRECT)
+        if args.reset:
+            device.request(TYPING_STATS_RESET)
+
+    positions = info_positions(args.info) if args.info else matrix_positions(len(keys) // cols, cols)
+    draw(keys, cols, positions, not args.no_color and sys.stdout.isatty())
+
+    total = sum(layers) or 1
+    print()
+    for layer, count in enumerate(layers):
+        name = LAYER_NAMES[layer] if layer < len(LAYER_NAMES) else f'layer {layer}'
+        print(f'{name:>10} {count:10} {100 * count / total:5.1f}%')
+    print(f'{"total":>10} {sum(keys):10}')
+    print(f'autocorrections: {autocorrect[0]}')
+
+
+if __name__ == '__main__':
+    main()
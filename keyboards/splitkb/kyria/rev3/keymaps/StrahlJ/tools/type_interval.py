@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Read or set the delay after every report of send_string_fast() and
+unicode_fast.c.
+
+Raise the Unicode interval if code points come out mangled, some input
+methods drop keys that arrive faster than they poll. The values last until
+the keyboard restarts; put the ones that work into config.h as
+SEND_STRING_FAST_INTERVAL and UNICODE_FAST_INTERVAL.
+
+Usage:
+    tools/type_interval.py
+    tools/type_interval.py [--string MS] [--unicode MS]
+"""
+
+import argparse
+
+from rawhid import RawHid, add_device_arguments
+
+TYPING_INTERVAL = 0xB0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--string', type=int, metavar='MS', help='interval of send_string_fast()')
+    parser.add_argument('--unicode', type=int, metavar='MS', help='interval of the Unicode input sequences')
+    add_device_arguments(parser)
+    args = parser.parse_args()
+
+    for value in (args.string, args.unicode):
+        if value is not None and not 0 <= value <= 255:
+            parser.error('intervals are 0 to 255 ms')
+
+    with RawHid(args.vid, args.pid) as device:
+        string_ms, unicode_ms = device.request(TYPING_INTERVAL)[1:3]
+        if args.string is not None or args.unicode is not None:
+            string_ms = args.string if args.string is not None else string_ms
+            unicode_ms = args.unicode if args.unicode is not None else unicode_ms
+            string_ms, unicode_ms = device.request(TYPING_INTERVAL, [1, string_ms, unicode_ms])[1:3]
+        print(f'send_string: {string_ms} ms, unicode: {unicode_ms} ms')
+
+
+if __name__ == '__main__':
+    main()
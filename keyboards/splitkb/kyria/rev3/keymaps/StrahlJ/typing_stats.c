@@ -0,0 +1,108 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "raw_hid_commands.h"
+#include "user_data.h"
+#include "typing_stats.h"
+
+_Static_assert(MATRIX_ROWS * MATRIX_COLS <= TYPING_STATS_KEYS, "raise TYPING_STATS_KEYS in user_data_layout.h");
+
+#define LAYERS_START TYPING_STATS_KEYS
+#define AUTOCORRECT_INDEX (TYPING_STATS_KEYS + TYPING_STATS_LAYERS)
+
+// Kept in RAM and only copied to flash by typing_stats_task() and
+// typing_stats_save(). Once any counter differs, the datablock update
+// rewrites the whole array into the wear leveling log, so saves are rationed.
+static uint32_t counters[TYPING_STATS_COUNTERS];
+static bool     dirty;
+static bool     saved; // since boot, the first save doesn't wait for the interval
+static uint32_t last_save;
+
+void typing_stats_init(void) {
+    user_data_region_init(USER_DATA_REGION_STATS, USER_DATA_STATS_VERSION, USER_DATA_STATS_OFFSET, USER_DATA_STATS_SIZE);
+    eeconfig_read_user_datablock(counters, USER_DATA_STATS_OFFSET, sizeof(counters));
+}
+
+static void save(void) {
+    eeconfig_update_user_datablock(counters, USER_DATA_STATS_OFFSET, sizeof(counters));
+    dirty     = false;
+    saved     = true;
+    last_save = timer_read32();
+}
+
+void typing_stats_save(void) {
+    if (dirty) save();
+}
+
+void typing_stats_key(keyrecord_t *record) {
+    keypos_t key = record->event.key;
+
+    if (!record->event.pressed || key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) return;
+    counters[key.row * MATRIX_COLS + key.col]++;
+    counters[LAYERS_START + MIN(get_highest_layer(layer_state | default_layer_state), TYPING_STATS_LAYERS - 1)]++;
+    dirty = true;
+}
+
+void typing_stats_autocorrect(void) {
+    counters[AUTOCORRECT_INDEX]++;
+    dirty = true;
+}
+
+void typing_stats_task(void) {
+    if (!dirty || last_input_activity_elapsed() < TYPING_STATS_SAVE_IDLE || (saved && timer_elapsed32(last_save) < TYPING_STATS_SAVE_INTERVAL)) {
+        return;
+    }
+    save();
+}
+
+#ifdef RAW_ENABLE
+#    define ENTRIES_PER_REPORT 6
+
+// RAW_HID_TYPING_STATS_READ [section][first] answers with
+// [cmd][section][first][section size][matrix cols][up to 6 counters u32].
+// RAW_HID_TYPING_STATS_RESET clears and saves the counters right away.
+bool typing_stats_raw_hid_receive(uint8_t *data, uint8_t length) {
+    switch (data[0]) {
+        case RAW_HID_TYPING_STATS_READ: {
+            uint8_t section = data[1];
+            uint8_t first   = data[2];
+            uint8_t start, size;
+
+            switch (section) {
+                case TYPING_STATS_SECTION_KEYS:
+                    start = 0;
+                    size  = MATRIX_ROWS * MATRIX_COLS;
+                    break;
+                case TYPING_STATS_SECTION_LAYERS:
+                    start = LAYERS_START;
+                    size  = MIN(keymap_layer_count(), TYPING_STATS_LAYERS);
+                    break;
+                case TYPING_STATS_SECTION_AUTOCORRECT:
+                    start = AUTOCORRECT_INDEX;
+                    size  = 1;
+                    break;
+                default:
+                    start = size = 0;
+                    break;
+            }
+
+            memset(data + 3, 0, length - 3);
+            data[3] = size;
+            data[4] = MATRIX_COLS;
+            for (uint8_t i = 0; i < ENTRIES_PER_REPORT && first + i < size; i++) {
+                raw_hid_put_u32(data + 5 + 4 * i, counters[start + first + i]);
+            }
+            break;
+        }
+        case RAW_HID_TYPING_STATS_RESET:
+            memset(counters, 0, sizeof(counters));
+            save();
+            break;
+        default:
+            return false;
+    }
+    raw_hid_send(data, length);
+    return true;
+}
+#endif
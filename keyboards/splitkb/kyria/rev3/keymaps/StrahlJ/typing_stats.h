@@ -0,0 +1,44 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+#include "user_data_layout.h"
+
+// Counters are saved once keys have been idle this long, after the first save
+// since boot no more often than every TYPING_STATS_SAVE_INTERVAL ms, so the
+// flash sees at most a couple of writes an hour and never one while typing.
+// Suspend saves right away through typing_stats_save().
+#ifndef TYPING_STATS_SAVE_IDLE
+#    define TYPING_STATS_SAVE_IDLE 60000
+#endif
+#ifndef TYPING_STATS_SAVE_INTERVAL
+#    define TYPING_STATS_SAVE_INTERVAL 1800000
+#endif
+
+enum typing_stats_section {
+    TYPING_STATS_SECTION_KEYS,        // presses per matrix position, row * MATRIX_COLS + col
+    TYPING_STATS_SECTION_LAYERS,      // presses per highest active layer
+    TYPING_STATS_SECTION_AUTOCORRECT, // corrections applied
+};
+
+// Loads the saved counters, call from keyboard_post_init_user() after user_data_init().
+void typing_stats_init(void);
+
+// Counts a physical press, call from pre_process_record_user().
+void typing_stats_key(keyrecord_t *record);
+
+// Call from apply_autocorrect().
+void typing_stats_autocorrect(void);
+
+// Saves the counters when due, call from housekeeping_task_user().
+void typing_stats_task(void);
+
+// Saves counts not saved yet regardless of the interval, call from
+// suspend_power_down_user().
+void typing_stats_save(void);
+
+#ifdef RAW_ENABLE
+bool typing_stats_raw_hid_receive(uint8_t *data, uint8_t length);
+#endif
@@ -0,0 +1,163 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "keymap_german.h"
+#include "send_string.h"
+#include "raw_hid_commands.h"
+#include "unicode_fast.h"
+
+static uint8_t interval = UNICODE_FAST_INTERVAL;
+
+static const uint8_t hex_keys[16] PROGMEM = {KC_0, KC_1, KC_2, KC_3, KC_4, KC_5, KC_6, KC_7, KC_8, KC_9, KC_A, KC_B, KC_C, KC_D, KC_E, KC_F};
+
+// Characters outside ASCII the host layout types with a single key.
+typedef struct {
+    uint16_t code_point;
+    uint16_t keycode;
+} layout_key_t;
+
+static const layout_key_t layout_keys[] PROGMEM = {
+    {0x00E4, DE_ADIA},    {0x00F6, DE_ODIA},    {0x00FC, DE_UDIA}, {0x00C4, S(DE_ADIA)}, {0x00D6, S(DE_ODIA)},
+    {0x00DC, S(DE_UDIA)}, {0x00DF, DE_SS},      {0x20AC, DE_EURO}, {0x00A7, DE_SECT},    {0x00B0, DE_DEG},
+};
+
+void unicode_fast_set_interval(uint8_t ms) {
+    interval = ms;
+}
+
+uint8_t unicode_fast_get_interval(void) {
+    return interval;
+}
+
+// Modifier keycodes keep the mods in 5 bits, bit 4 selecting the right hand ones.
+static uint8_t keycode_mods(uint16_t keycode) {
+    uint8_t mods = QK_MODS_GET_MODS(keycode);
+    return mods & 0x10 ? (mods & 0x0F) << 4 : mods;
+}
+
+static bool add_layout_key(uint32_t code_point) {
+    for (uint8_t i = 0; i < ARRAY_SIZE(layout_keys); i++) {
+        if (pgm_read_word(&layout_keys[i].code_point) == code_point) {
+            uint16_t keycode = pgm_read_word(&layout_keys[i].keycode);
+            send_keys_fast_add(QK_MODS_GET_BASIC_KEYCODE(keycode), keycode_mods(keycode));
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t unicode_fast_key_code_point(uint8_t keycode, uint8_t mods) {
+    uint8_t wanted = (mods & MOD_MASK_SHIFT ? MOD_BIT(KC_LSFT) : 0) | (mods & MOD_BIT(KC_RALT) ? MOD_BIT(KC_RALT) : 0);
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(layout_keys); i++) {
+        uint16_t layout_keycode = pgm_read_word(&layout_keys[i].keycode);
+        if (QK_MODS_GET_BASIC_KEYCODE(layout_keycode) == keycode && keycode_mods(layout_keycode) == wanted) {
+            return pgm_read_word(&layout_keys[i].code_point);
+        }
+    }
+    for (uint8_t ascii = 1; ascii < 128; ascii++) {
+        if (pgm_read_byte(&ascii_to_keycode_lut[ascii]) != keycode || PGM_LOADBIT(ascii_to_dead_lut, ascii)) continue;
+        uint8_t ascii_mods = (PGM_LOADBIT(ascii_to_shift_lut, ascii) ? MOD_BIT(KC_LSFT) : 0) | (PGM_LOADBIT(ascii_to_altgr_lut, ascii) ? MOD_BIT(KC_RALT) : 0);
+        if (ascii_mods == wanted) return ascii;
+    }
+    return 0;
+}
+
+static void add_code_point(uint32_t code_point) {
+    if (code_point > 0x10FFFF) return;
+    if (get_unicode_input_mode() != UNICODE_MODE_LINUX) {
+        send_keys_fast_flush();
+        register_unicode(code_point);
+        return;
+    }
+
+    // As in unicode_input_start(), Caps Lock is off while the sequence is
+    // typed, it would shift the input method key.
+    bool caps_lock = host_keyboard_led_state().caps_lock;
+    if (caps_lock) send_keys_fast_add(KC_CAPS_LOCK, 0);
+    send_keys_fast_add(QK_MODS_GET_BASIC_KEYCODE(UNICODE_KEY_LNX), keycode_mods(UNICODE_KEY_LNX));
+    // Leading zeros are left out, the input method takes one to six digits.
+    uint8_t shift = 20;
+    while (shift && !((code_point >> shift) & 0xF)) {
+        shift -= 4;
+    }
+    for (;; shift -= 4) {
+        send_keys_fast_add(pgm_read_byte(&hex_keys[(code_point >> shift) & 0xF]), 0);
+        if (!shift) break;
+    }
+    send_keys_fast_add(KC_SPC, 0);
+    if (caps_lock) send_keys_fast_add(KC_CAPS_LOCK, 0);
+}
+
+uint16_t unicode_fast_send(uint32_t code_point) {
+    send_keys_fast_begin(interval);
+    add_code_point(code_point);
+    return send_keys_fast_end();
+}
+
+// Decodes one UTF-8 sequence, malformed ones come out as 0 and are skipped.
+static const char *next_code_point(const char *str, uint32_t *code_point) {
+    uint8_t lead  = *str++;
+    uint8_t extra = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+
+    if ((lead & 0xC0) == 0x80) {
+        *code_point = 0;
+        return str;
+    }
+    *code_point = extra ? lead & (0x3F >> extra) : lead;
+    for (; extra && (*str & 0xC0) == 0x80; extra--) {
+        *code_point = *code_point << 6 | (*str++ & 0x3F);
+    }
+    if (extra) *code_point = 0;
+    return str;
+}
+
+uint16_t unicode_fast_send_string(const char *utf8) {
+    send_keys_fast_begin(interval);
+    while (*utf8) {
+        uint32_t code_point;
+
+        utf8 = next_code_point(utf8, &code_point);
+        if (!code_point) continue;
+        if (code_point < 0x80) {
+            send_keys_fast_add_char(code_point);
+        } else if (!add_layout_key(code_point)) {
+            add_code_point(code_point);
+        }
+    }
+    return send_keys_fast_end();
+}
+
+// RAW_HID_TYPING_INTERVAL takes [cmd][set][send_string ms][unicode ms] and
+// answers [cmd][send_string ms][unicode ms], the intervals only change if
+// `set` isn't 0.
+bool unicode_fast_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (data[0] != RAW_HID_TYPING_INTERVAL) return false;
+
+    if (data[1]) {
+        send_string_fast_set_interval(data[2]);
+        unicode_fast_set_interval(data[3]);
+    }
+    data[1] = send_string_fast_get_interval();
+    data[2] = unicode_fast_get_interval();
+    data[3] = 0;
+    raw_hid_send(data, length);
+    return true;
+}
+
+#ifdef UNICODEMAP_ENABLE
+uint16_t unicode_fast_send_map(uint16_t index) {
+    return unicode_fast_send(unicodemap_get_code_point(index));
+}
+
+bool process_unicode_fast(uint16_t keycode, keyrecord_t *record) {
+    if (!IS_QK_UNICODEMAP(keycode) && !IS_QK_UNICODEMAP_PAIR(keycode)) return true;
+    if (get_unicode_input_mode() != UNICODE_MODE_LINUX) return true;
+
+    // unicodemap_index() picks the shifted entry of a pair from the held mods,
+    // which unicode_fast_send() clears while it types.
+    if (record->event.pressed) unicode_fast_send_map(unicodemap_index(keycode));
+    return false;
+}
+#endif
@@ -0,0 +1,47 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+#include "send_string_fast.h"
+
+// Delay after every report in ms. IBus drops keys on some systems when it is
+// fed faster than it polls, raise this if code points come out mangled.
+#ifndef UNICODE_FAST_INTERVAL
+#    define UNICODE_FAST_INTERVAL SEND_STRING_FAST_INTERVAL
+#endif
+
+// Types one code point with the Linux input method sequence, UNICODE_KEY_LNX,
+// the hex digits and space, batched like send_string_fast(): one report per
+// key and one per modifier change, about half of what register_unicode()
+// sends. Caps Lock is turned off around the sequence as QMK does. Other input
+// modes fall back to register_unicode(). Returns the number of reports sent.
+uint16_t unicode_fast_send(uint32_t code_point);
+
+#ifdef UNICODEMAP_ENABLE
+// Types unicode_map[index], see unicode_fast_send().
+uint16_t unicode_fast_send_map(uint16_t index);
+
+// Handles UM() and UP() keycodes, call from process_record_user(). Returns
+// false if the event was consumed.
+bool process_unicode_fast(uint16_t keycode, keyrecord_t *record);
+#endif
+
+// Types a UTF-8 string in one batch. ASCII and the characters the German host
+// layout has keys for (umlauts, ß, €, § and °) are typed directly, everything
+// else as code points.
+uint16_t unicode_fast_send_string(const char *utf8);
+
+// The character a key types on the host with the given mods, 0 if none or a
+// dead key. Shift and AltGr are the only mods that count.
+uint32_t unicode_fast_key_code_point(uint8_t keycode, uint8_t mods);
+
+// The report interval, UNICODE_FAST_INTERVAL at boot. Set from the host with
+// tools/type_interval.py.
+void    unicode_fast_set_interval(uint8_t ms);
+uint8_t unicode_fast_get_interval(void);
+
+// Answers RAW_HID_TYPING_INTERVAL, which reads or sets this interval and
+// send_string_fast()'s. Returns false for other commands.
+bool unicode_fast_raw_hid_receive(uint8_t *data, uint8_t length);
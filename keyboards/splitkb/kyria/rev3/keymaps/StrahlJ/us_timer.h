@@ -0,0 +1,21 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+
+// Microsecond timestamps for profiling and event recording. The RP2040's
+// Cortex-M0+ has no cycle counter, so the free running 1 MHz TIMERAWL register
+// of the TIMER peripheral is read directly, through the register struct of
+// ChibiOS's RP2040 header as its system tick does; it needs no latching and
+// wraps after about 71 minutes, which unsigned differences handle.
+#if defined(MCU_RP) || defined(RP2040)
+static inline uint32_t us_timer_read(void) {
+    return TIMER->TIMERAWL;
+}
+#else
+static inline uint32_t us_timer_read(void) {
+    return timer_read32() * 1000;
+}
+#endif
@@ -0,0 +1,33 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include QMK_KEYBOARD_H
+#include "user_data.h"
+
+_Static_assert(USER_DATA_SIZE <= EECONFIG_USER_DATA_SIZE, "user_data.h regions do not fit EECONFIG_USER_DATA_SIZE");
+_Static_assert(USER_DATA_REGION_AC_OVERLAY < USER_DATA_VERSIONS_SIZE, "raise USER_DATA_VERSIONS_SIZE");
+
+void user_data_init(void) {
+    if (!eeconfig_is_user_datablock_valid()) {
+        eeconfig_init_user_datablock();
+    }
+}
+
+bool user_data_region_init(uint8_t region, uint8_t version, uint32_t offset, uint32_t size) {
+    uint8_t stored;
+
+    eeconfig_read_user_datablock(&stored, USER_DATA_VERSIONS_OFFSET + region, 1);
+    if (stored == version) {
+        return true;
+    }
+
+    // Cleared before the version is written, so a clear cut short by a power
+    // loss is done again on the next boot. Written in small chunks to keep
+    // the stack small, update only touches bytes that differ.
+    uint8_t zeros[32] = {0};
+    for (uint32_t done = 0; done < size; done += sizeof(zeros)) {
+        eeconfig_update_user_datablock(zeros, offset + done, MIN(sizeof(zeros), size - done));
+    }
+    eeconfig_update_user_datablock(&version, USER_DATA_VERSIONS_OFFSET + region, 1);
+    return false;
+}
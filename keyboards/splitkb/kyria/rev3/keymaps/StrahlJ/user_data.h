@@ -0,0 +1,17 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "quantum.h"
+#include "user_data_layout.h"
+
+// Clears the whole datablock through QMK when its EECONFIG_USER_DATA_VERSION
+// doesn't match, e.g. on a fresh board. Call before the modules load their
+// regions.
+void user_data_init(void);
+
+// Checks the version byte of `region`, and clears the region's `size` bytes
+// at `offset` if it differs. Returns false in that case, the region then
+// reads as zeros. Other regions are left alone.
+bool user_data_region_init(uint8_t region, uint8_t version, uint32_t offset, uint32_t size);
@@ -0,0 +1,49 @@
+// Copyright 2026 StrahlJ
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Layout of the EECONFIG user datablock, which lives in the RP2040's wear
+// leveled flash. Each module that persists state owns a fixed region and a
+// version byte for it at the start of the block. Bump a region's version
+// whenever it moves or changes format; only that region is then cleared on
+// the next boot instead of being misread, see user_data_region_init(). A
+// region that grows moves the ones after it, so their versions go up too.
+// Only defines here, config.h includes this file for EECONFIG_USER_DATA_SIZE.
+
+// One version byte per region. 0 is a cleared block, so versions start at 1.
+#define USER_DATA_VERSIONS_OFFSET 0
+#define USER_DATA_VERSIONS_SIZE 4
+#define USER_DATA_REGION_MACROS 0
+#define USER_DATA_REGION_STATS 1
+#define USER_DATA_REGION_AC_OVERLAY 2
+
+// Two dynamic macro slots, each a 16-bit length and a CRC-16 of length and
+// events, followed by the events.
+#ifndef DYN_MACRO_SIZE
+#    define DYN_MACRO_SIZE 1020
+#endif
+#define DYN_MACRO_HEADER 4
+#define USER_DATA_MACRO_VERSION 2
+#define USER_DATA_MACRO_OFFSET (USER_DATA_VERSIONS_OFFSET + USER_DATA_VERSIONS_SIZE)
+#define USER_DATA_MACRO_SIZE (2 * (DYN_MACRO_HEADER + DYN_MACRO_SIZE))
+
+// Typing statistics, u32 counters: presses per matrix position, presses per
+// top layer and autocorrect hits. Sized for any matrix up to 64 keys.
+#define TYPING_STATS_KEYS 64
+#define TYPING_STATS_LAYERS 8
+#define TYPING_STATS_COUNTERS (TYPING_STATS_KEYS + TYPING_STATS_LAYERS + 1)
+#define USER_DATA_STATS_VERSION 1
+#define USER_DATA_STATS_OFFSET (USER_DATA_MACRO_OFFSET + USER_DATA_MACRO_SIZE)
+#define USER_DATA_STATS_SIZE (4 * TYPING_STATS_COUNTERS)
+
+// Autocorrect rules learned at runtime, two banks of AC_OVERLAY_SIZE bytes
+// that take turns when the rules are compacted, see ac_overlay.c.
+#ifndef AC_OVERLAY_SIZE
+#    define AC_OVERLAY_SIZE 4096
+#endif
+#define USER_DATA_AC_OVERLAY_VERSION 1
+#define USER_DATA_AC_OVERLAY_OFFSET (USER_DATA_STATS_OFFSET + USER_DATA_STATS_SIZE)
+#define USER_DATA_AC_OVERLAY_SIZE (2 * AC_OVERLAY_SIZE)
+
+#define USER_DATA_SIZE (USER_DATA_AC_OVERLAY_OFFSET + USER_DATA_AC_OVERLAY_SIZE)